@@ -0,0 +1,269 @@
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <condition_variable>
+
+/**
+ * Snapshot of BufferPool occupancy and allocation counters
+ */
+struct BufferPoolStats {
+    // Limit on bytes handed out to callers and on bytes kept from the OS
+    size_t capacityBytes = 0;
+    // Bytes handed out to callers
+    size_t inUseBytes = 0;
+    // Bytes obtained from the OS, including cached and in-use buffers
+    size_t reservedBytes = 0;
+    // Buffers handed out to callers
+    size_t inUseBuffers = 0;
+    // Total acquire() calls that returned a buffer
+    size_t acquires = 0;
+    // Acquires served from a per-thread cache
+    size_t threadCacheHits = 0;
+    // Acquires served from the shared free lists
+    size_t sharedHits = 0;
+    // Acquires that needed new memory from the OS
+    size_t osAllocations = 0;
+    // Acquires that had to wait for capacity
+    size_t waits = 0;
+    // Acquires that timed out or failed to allocate
+    size_t failures = 0;
+};
+
+/**
+ * BufferPool class hands out page-aligned I/O buffers in power-of-two size
+ * classes and recycles them instead of returning memory to the allocator.
+ *
+ * Small classes are carved from 2 MB slabs, large classes are allocated
+ * individually; both are aligned and advised for transparent huge pages.
+ * Each thread keeps a small cache of recently released small buffers.
+ * Bytes handed out are limited by a global capacity: acquire() blocks until
+ * other buffers are released when the capacity would be exceeded. The same
+ * capacity bounds memory kept from the OS: before new memory would take the
+ * reserved total over it, idle large buffers and slabs whose buffers are all
+ * back on the shared free lists are freed. Partly used slabs and per-thread
+ * caches cannot be freed, so reserved memory may exceed the capacity by them.
+ * A capacity below one slab per small class in use makes slabs churn to the OS.
+ */
+class BufferPool {
+public:
+    /**
+     * Move-only handle to a pooled buffer, released back to the pool on destruction
+     */
+    class Buffer {
+    public:
+        /**
+         * Constructor - Creates an empty handle
+         */
+        Buffer();
+
+        /**
+         * Destructor - Returns the buffer to the pool
+         */
+        ~Buffer();
+
+        Buffer(Buffer&& other);
+        Buffer& operator=(Buffer&& other);
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+
+        /**
+         * Get buffer memory
+         * @return Buffer memory, or nullptr for an empty handle
+         */
+        char* data() const { return data_; }
+
+        /**
+         * Get usable buffer size, at least the requested size
+         * @return Buffer capacity in bytes
+         */
+        size_t capacity() const { return capacity_; }
+
+        /**
+         * Check whether the handle holds a buffer
+         * @return Whether data() is usable
+         */
+        bool valid() const { return data_ != nullptr; }
+
+        /**
+         * Return the buffer to the pool early
+         */
+        void release();
+
+    private:
+        friend class BufferPool;
+
+        Buffer(char* data, size_t capacity, int sizeClass);
+
+        char* data_;
+        size_t capacity_;
+        int sizeClass_;
+    };
+
+    /**
+     * Get the process-wide pool used by all read and write paths
+     * @return Shared pool instance
+     */
+    static BufferPool& instance();
+
+    /**
+     * Acquire a buffer of at least size bytes, waiting while the pool is at capacity
+     * @param size Requested size in bytes
+     * @return Buffer handle, empty if memory allocation failed
+     */
+    Buffer acquire(size_t size);
+
+    /**
+     * Acquire a buffer, waiting at most timeout for capacity
+     * @param size Requested size in bytes
+     * @param timeout Maximum time to wait for other buffers to be released
+     * @return Buffer handle, empty on timeout or allocation failure
+     */
+    Buffer tryAcquire(size_t size, std::chrono::milliseconds timeout);
+
+    /**
+     * Set the limit on bytes handed out to callers and kept from the OS. A single
+     * request larger than the capacity is still served once nothing else is in use.
+     * @param bytes Capacity in bytes
+     */
+    void setCapacity(size_t bytes);
+
+    /**
+     * Get occupancy and allocation counters
+     * @return Statistics snapshot
+     */
+    BufferPoolStats stats() const;
+
+    /**
+     * Print occupancy and allocation counters
+     * @param out Output stream
+     */
+    void printStats(std::ostream& out) const;
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+private:
+    // Smallest size class is one page
+    static const size_t kMinClassSize = 4096;
+    // Size classes 4 KB .. 64 MB, larger requests are allocated directly
+    static const int kNumClasses = 15;
+    // Classes smaller than a slab are carved from slabs of this size
+    static const size_t kSlabSize = 2 * 1024 * 1024;
+    // Classes up to this size are kept in per-thread caches
+    static const size_t kThreadCacheMaxSize = 256 * 1024;
+    // Buffers kept per class in each per-thread cache
+    static const size_t kThreadCacheDepth = 8;
+    // Bytes kept in each per-thread cache across all classes
+    static const size_t kThreadCacheBytes = 1024 * 1024;
+    // Default capacity
+    static const size_t kDefaultCapacity = 256 * 1024 * 1024;
+
+    /**
+     * Per-thread cache of released small buffers, drained to the shared lists on thread exit
+     */
+    struct ThreadCache {
+        std::vector<char*> buffers[kNumClasses];
+        size_t bytes = 0;
+        ~ThreadCache();
+    };
+
+    /**
+     * Slab carved into buffers of one small size class
+     */
+    struct Slab {
+        int sizeClass;
+        // Buffers of this slab on the shared free list
+        size_t freeBuffers;
+    };
+
+    BufferPool();
+
+    static ThreadCache& threadCache();
+    static int sizeClassFor(size_t size);
+    static size_t classSize(int sizeClass);
+
+    /**
+     * Account bytes as in use if that stays within capacity
+     * @param bytes Bytes to reserve
+     * @return Whether bytes were reserved
+     */
+    bool tryReserve(size_t bytes);
+
+    /**
+     * Acquire implementation, waits forever when hasTimeout is false
+     */
+    Buffer acquireImpl(size_t size, bool hasTimeout, std::chrono::milliseconds timeout);
+
+    /**
+     * Take a free buffer from the shared lists or allocate new memory
+     * @param sizeClass Size class, kNumClasses for direct allocations
+     * @param bytes Buffer size in bytes
+     * @return Buffer memory, or nullptr on allocation failure
+     */
+    char* takeShared(int sizeClass, size_t bytes);
+
+    /**
+     * Push a buffer onto its shared free list, caller holds mutex_
+     * @param sizeClass Size class
+     * @param data Buffer memory
+     */
+    void pushFreeLocked(int sizeClass, char* data);
+
+    /**
+     * Pop a buffer from a shared free list, caller holds mutex_
+     * @param sizeClass Size class
+     * @return Buffer memory, or nullptr if the list is empty
+     */
+    char* popFreeLocked(int sizeClass);
+
+    /**
+     * Free idle large buffers, then idle slabs, until reserved memory is at most limit.
+     * Caller holds mutex_
+     * @param limit Target for reserved bytes
+     */
+    void trimLocked(size_t limit);
+
+    /**
+     * Allocate aligned memory from the OS
+     * @param bytes Allocation size
+     * @return Memory, or nullptr on failure
+     */
+    char* allocateAligned(size_t bytes);
+
+    /**
+     * Return a buffer to the pool
+     * @param data Buffer memory
+     * @param capacity Buffer size in bytes
+     * @param sizeClass Size class, kNumClasses for direct allocations
+     */
+    void release(char* data, size_t capacity, int sizeClass);
+
+    // Protects freeLists_, slabs_ and capacity waits
+    mutable std::mutex mutex_;
+    std::condition_variable released_;
+    // Shared free buffers per size class
+    std::vector<char*> freeLists_[kNumClasses];
+    // Slabs carved into small-class buffers, keyed by start address
+    std::map<char*, Slab> slabs_;
+
+    std::atomic<size_t> capacity_;
+    std::atomic<size_t> inUseBytes_;
+    std::atomic<size_t> reservedBytes_;
+    std::atomic<size_t> inUseBuffers_;
+    std::atomic<size_t> waiters_;
+    std::atomic<size_t> acquires_;
+    std::atomic<size_t> threadCacheHits_;
+    std::atomic<size_t> sharedHits_;
+    std::atomic<size_t> osAllocations_;
+    std::atomic<size_t> waits_;
+    std::atomic<size_t> failures_;
+};
+
+#endif // BUFFER_POOL_H
@@ -22,6 +22,12 @@ public:
      */
     bool loadFromFile(const std::string& configPath);
     
+    /**
+     * Set whether informational messages are printed (errors are always printed)
+     * @param verbose Whether to print informational messages
+     */
+    void setVerbose(bool verbose);
+    
     /**
      * Get configuration value for specified key
      * @param key Configuration key
@@ -58,6 +64,8 @@ private:
     
     // Store configuration key-value pairs
     std::map<std::string, std::string> configs_;
+    // Whether informational messages are printed
+    bool verbose_;
 };
 
 #endif // CONFIG_LOADER_H 
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef FILE_FOLLOWER_H
+#define FILE_FOLLOWER_H
+
+#include <string>
+#include <chrono>
+#include <functional>
+#include <hdfs.h>
+
+/**
+ * FileFollower class incrementally reads bytes appended to one HDFS file.
+ *
+ * It keeps the file open and remembers the last offset, reading only new
+ * bytes with positional reads. An open stream does not learn about bytes
+ * appended after it was opened, so once the stream is exhausted the file is
+ * reopened to refresh its visible length, including the block still being
+ * written. The poll interval backs off while the file is idle. Read errors
+ * (for example after lease recovery moved the last block) and deleted or
+ * truncated files are handled by reopening.
+ */
+class FileFollower {
+public:
+    // Receives newly appended bytes
+    typedef std::function<void(const std::string& path, const char* data, size_t length)> DataSink;
+
+    /**
+     * Constructor
+     * @param fs HDFS file system handle
+     * @param path File path
+     * @param initialBytes Bytes before the current end to deliver on the first poll
+     * @param minInterval Poll interval while data is arriving
+     * @param maxInterval Longest poll interval while the file is idle
+     */
+    FileFollower(hdfsFS fs, const std::string& path, size_t initialBytes,
+                 std::chrono::milliseconds minInterval, std::chrono::milliseconds maxInterval);
+
+    /**
+     * Destructor - Closes the file
+     */
+    ~FileFollower();
+
+    FileFollower(const FileFollower&) = delete;
+    FileFollower& operator=(const FileFollower&) = delete;
+
+    /**
+     * Deliver bytes appended since the last poll and schedule the next poll
+     * @param sink Receives new data
+     * @return Number of bytes delivered
+     */
+    size_t poll(const DataSink& sink);
+
+    /**
+     * Check whether the last poll stopped at its per-poll byte limit, so more
+     * data may already be available without waiting
+     * @return Whether the last poll was cut short
+     */
+    bool truncatedPoll() const;
+
+    /**
+     * Get the time the next poll is due
+     * @return Next poll time
+     */
+    std::chrono::steady_clock::time_point nextPoll() const;
+
+    /**
+     * Get the file path
+     * @return File path
+     */
+    const std::string& path() const;
+
+    /**
+     * Check whether the file could not be opened on the last poll
+     * @return Whether the file is missing
+     */
+    bool missing() const;
+
+private:
+    /**
+     * Close the current stream and open a fresh one positioned at the last offset
+     * @return Whether the file could be opened
+     */
+    bool reopen();
+
+    /**
+     * Positional-read new bytes from the open stream
+     * @param sink Receives new data
+     * @param failed Set when a read error occurred
+     * @return Number of bytes delivered
+     */
+    size_t readAppended(const DataSink& sink, bool& failed);
+
+    /**
+     * Close the current stream
+     */
+    void close();
+
+    hdfsFS fs_;
+    std::string path_;
+    hdfsFile file_;
+    // Offset of the next byte to deliver, -1 until the file was first opened
+    tOffset offset_;
+    size_t initialBytes_;
+    std::chrono::milliseconds minInterval_;
+    std::chrono::milliseconds maxInterval_;
+    // Current poll interval, doubles while idle
+    std::chrono::milliseconds interval_;
+    std::chrono::steady_clock::time_point nextPoll_;
+    // Whether the file was missing on the last poll, to report it only once
+    bool missing_;
+    // Whether the last poll hit its byte limit
+    bool truncatedPoll_;
+};
+
+#endif // FILE_FOLLOWER_H
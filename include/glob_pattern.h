@@ -0,0 +1,110 @@
+#ifndef GLOB_PATTERN_H
+#define GLOB_PATTERN_H
+
+#include <string>
+#include <vector>
+
+/**
+ * GlobPattern class splits a path pattern into per-directory components
+ * and matches single path components against them.
+ * Supports '*', '?', '[...]' (with '!' or '^' negation and ranges),
+ * backslash escapes, and '**' as a whole component matching zero or more directories.
+ */
+class GlobPattern {
+public:
+    /**
+     * Constructor
+     * @param pattern Path pattern, optionally prefixed with scheme://authority
+     */
+    explicit GlobPattern(const std::string& pattern);
+
+    /**
+     * Get the path that expansion starts from: scheme://authority plus "/" for
+     * absolute patterns, or an empty string for relative patterns
+     * @return Root path
+     */
+    const std::string& root() const;
+
+    /**
+     * Get the scheme://authority prefix of the pattern
+     * @return Prefix, or an empty string if the pattern has none
+     */
+    const std::string& authority() const;
+
+    /**
+     * Get the pattern components between '/' separators
+     * @return Pattern components
+     */
+    const std::vector<std::string>& components() const;
+
+    /**
+     * Check whether text contains any wildcard characters
+     * @param text Pattern or pattern component
+     * @return Whether text needs to be matched against a directory listing
+     */
+    static bool hasWildcard(const std::string& text);
+
+    /**
+     * Check whether a component is the recursive wildcard '**'
+     * @param component Pattern component
+     * @return Whether component matches zero or more directories
+     */
+    static bool isRecursiveWildcard(const std::string& component);
+
+    /**
+     * Match a single path component (no '/') against a pattern component
+     * @param pattern Pattern component
+     * @param name Path component
+     * @return Whether name matches pattern
+     */
+    static bool matchComponent(const std::string& pattern, const std::string& name);
+
+    /**
+     * Remove backslash escapes from a literal pattern or pattern component
+     * @param component Pattern or pattern component without wildcards
+     * @return Literal path component
+     */
+    static std::string unescape(const std::string& component);
+
+    /**
+     * Append a component to a path
+     * @param parent Parent path, may be empty for relative paths
+     * @param name Path component
+     * @return Joined path
+     */
+    static std::string join(const std::string& parent, const std::string& name);
+
+    /**
+     * Strip scheme and authority from a URI, so "hdfs://nn:8020/a" and "file:/a" become "/a"
+     * @param uri Path or URI
+     * @return Path part, unchanged for plain paths
+     */
+    static std::string pathOf(const std::string& uri);
+
+    /**
+     * Get the last component of a path or URI
+     * @param path Path or URI
+     * @return Last path component
+     */
+    static std::string baseName(const std::string& path);
+
+private:
+    /**
+     * Match a bracket expression starting at pattern[pos] == '['
+     * @param pattern Pattern component
+     * @param pos Position of '[', updated to the position after ']'
+     * @param c Character to match
+     * @param matched Whether c matched the expression
+     * @return Whether a well-formed bracket expression was found
+     */
+    static bool matchBracket(const std::string& pattern, size_t& pos, char c, bool& matched);
+
+    // scheme://authority prefix
+    std::string authority_;
+    // Expansion root
+    std::string root_;
+    // Pattern components
+    std::vector<std::string> components_;
+};
+
+#endif // GLOB_PATTERN_H
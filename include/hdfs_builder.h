@@ -84,6 +84,13 @@ public:
      */
     HdfsBuilder& setKeyTabFile(const std::string& keytabFile);
     
+    /**
+     * Set whether informational messages are printed (errors are always printed)
+     * @param verbose Whether to print informational messages
+     * @return Reference to the current builder instance for chained calls
+     */
+    HdfsBuilder& setVerbose(bool verbose);
+    
     /**
      * Connect to HDFS and return file system handle
      * @return HDFS file system handle, or nullptr if connection fails
@@ -97,6 +104,8 @@ private:
     struct hdfsBuilder* builder_;
     // Whether default configuration has been set
     bool useDefault_;
+    // Whether informational messages are printed
+    bool verbose_;
 };
 
 #endif // HDFS_BUILDER_H 
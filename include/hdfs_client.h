@@ -3,15 +3,72 @@
 
 #include <string>
 #include <vector>
+#include <set>
+#include <future>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <chrono>
 #include <hdfs.h>
 #include "hdfs_builder.h"
 #include "config_loader.h"
+#include "startup_profiler.h"
+#include "file_follower.h"
+#include "buffer_pool.h"
 
+// Options for deleting all paths matching a glob pattern
+struct DeleteOptions {
+    // Delete non-empty directories
+    bool recursive = false;
+    // Only report matches, delete nothing
+    bool dryRun = false;
+    // Refuse to delete when more paths match (0 means no limit)
+    size_t maxMatches = 10000;
+    // Number of concurrent delete workers, each using its own pooled connection
+    int parallelism = 8;
+    // Called with (completed, total) as deletes finish, from worker threads
+    std::function<void(size_t, size_t)> progress;
+};
+
+// Outcome of a glob delete
+struct DeleteResult {
+    size_t matched = 0;
+    size_t deleted = 0;
+    size_t failed = 0;
+};
+
+// Options for following files that are being appended
+struct FollowOptions {
+    // Bytes before the current end of each file to print first
+    size_t initialBytes = 1024;
+    // Keep polling for appended bytes, otherwise stop after the first read
+    bool follow = true;
+    // Poll interval while data is arriving
+    std::chrono::milliseconds minInterval = std::chrono::milliseconds(100);
+    // Longest poll interval while a file is idle
+    std::chrono::milliseconds maxInterval = std::chrono::milliseconds(5000);
+    // Following stops once this becomes true (may be nullptr)
+    const std::atomic<bool>* stop = nullptr;
+};
+
+// HdfsClient is safe to share between threads: file operations run concurrently,
+// while connect() and disconnect() wait for running operations to finish.
+// libhdfs attaches each calling thread to the JVM on first use.
 class HdfsClient {
 public:
     HdfsClient();
     ~HdfsClient();
 
+    // Record startup phase timings into profiler (may be nullptr)
+    void setStartupProfiler(StartupProfiler* profiler);
+
+    // Set whether per-operation informational messages are printed (errors are always printed)
+    void setVerbose(bool verbose);
+
+    // Start booting the JVM in the background; only config loading overlaps with it
+    void warmUp();
+
     // Connect to HDFS
     bool connect();
 
@@ -21,18 +78,69 @@ public:
     // List files in a directory
     std::vector<std::string> listDirectory(const std::string& path);
     
-    // Read a file from HDFS
+    // Read a file from HDFS into a pooled buffer, length receives the bytes read
+    bool readFile(const std::string& path, BufferPool::Buffer& buffer, size_t& length);
+
+    // Read a file from HDFS into a string, copying out of the pooled buffer
     bool readFile(const std::string& path, std::string& content);
     
     // Write a file to HDFS
     bool writeFile(const std::string& path, const std::string& content);
+
+    // Write a file to HDFS directly from caller memory, without copying
+    bool writeFile(const std::string& path, const char* data, size_t length);
     
-    // Delete a file from HDFS
-    bool deleteFile(const std::string& path);
+    // Delete a file from HDFS, directories require recursive
+    bool deleteFile(const std::string& path, bool recursive = false);
+
+    // Expand a glob pattern (*, ?, [...], **) against directory listings.
+    // Matches are absolute paths, qualified only if the pattern is.
+    // Fails if more than maxMatches paths match (0 means no limit).
+    bool expandGlob(const std::string& pattern, size_t maxMatches, std::vector<std::string>& matches);
+
+    // Delete all paths matching a glob pattern concurrently
+    bool deleteGlob(const std::string& pattern, const DeleteOptions& options, DeleteResult& result);
+
+    // Deliver the tail of each file, then bytes appended to them until options.stop is set.
+    // All files are polled from the calling thread.
+    bool followFiles(const std::vector<std::string>& paths, const FollowOptions& options,
+                     const FileFollower::DataSink& sink);
 
 private:
+    // Start the background JVM boot, caller holds stateMutex_ exclusively
+    void startWarmUp();
+
+    // expandGlob() implementation, caller holds stateMutex_
+    bool expandGlobLocked(const std::string& pattern, size_t maxMatches, std::vector<std::string>& matches);
+
+    // Open a new connection using the loaded configuration
+    hdfsFS openConnection(bool verbose);
+
+    // Get up to count connections: the main one plus pooled extra connections
+    std::vector<hdfsFS> acquireConnections(size_t count);
+
+    // Recursively expand pattern components starting at components[index] under dir.
+    // dirListed tells whether dir is already known to be an existing directory.
+    bool expandComponents(const std::string& dir, bool dirListed, const std::vector<std::string>& components,
+                          size_t index, size_t maxMatches, std::set<std::string>& matches);
+
+    // Shared by file operations, exclusive for connect/disconnect
+    mutable std::shared_timed_mutex stateMutex_;
     hdfsFS fs_;
     bool connected_;
+    ConfigLoader configLoader_;
+    bool configLoaded_;
+    std::string defaultFs_;
+    // Atomic so setVerbose() may run while other threads use the client
+    std::atomic<bool> verbose_;
+    // Extra connections used by parallel operations, released on disconnect
+    std::vector<hdfsFS> pool_;
+    // Protects pool_ growth from concurrent parallel operations
+    std::mutex poolMutex_;
+    // Atomic like verbose_, read by connect() and the JVM warm-up
+    std::atomic<StartupProfiler*> profiler_;
+    // Result of the background JVM boot started by warmUp()
+    std::future<bool> jvmWarmup_;
 };
 
 #endif // HDFS_CLIENT_H 
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef STARTUP_PROFILER_H
+#define STARTUP_PROFILER_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <ostream>
+
+/**
+ * StartupProfiler class records wall-clock timings of client startup phases
+ * (config load, JVM init, Kerberos login, NameNode connect).
+ * Phases may run concurrently on different threads, so all offsets are
+ * measured from the moment the profiler was created.
+ */
+class StartupProfiler {
+public:
+    /**
+     * RAII helper that records a phase for the lifetime of the object
+     */
+    class Scope {
+    public:
+        /**
+         * Begin a phase
+         * @param profiler Profiler to record into, may be nullptr
+         * @param phase Phase name
+         */
+        Scope(StartupProfiler* profiler, const std::string& phase);
+
+        /**
+         * End the phase
+         */
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        StartupProfiler* profiler_;
+        std::string phase_;
+    };
+
+    /**
+     * Constructor - Startup time origin is the construction time
+     */
+    StartupProfiler();
+
+    /**
+     * Mark the beginning of a phase
+     * @param phase Phase name
+     */
+    void begin(const std::string& phase);
+
+    /**
+     * Mark the end of a phase previously started with begin()
+     * @param phase Phase name
+     */
+    void end(const std::string& phase);
+
+    /**
+     * Print a report of all recorded phases
+     * @param out Output stream
+     */
+    void printReport(std::ostream& out) const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Phase {
+        std::string name;
+        Clock::time_point start;
+        Clock::time_point end;
+        bool finished;
+    };
+
+    // Time origin for all phase offsets
+    Clock::time_point origin_;
+    // Recorded phases in start order
+    std::vector<Phase> phases_;
+    // Protects phases_, phases are recorded from multiple threads
+    mutable std::mutex mutex_;
+};
+
+#endif // STARTUP_PROFILER_H
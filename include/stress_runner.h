@@ -0,0 +1,92 @@
+#ifndef STRESS_RUNNER_H
+#define STRESS_RUNNER_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include "hdfs_client.h"
+
+/**
+ * Options for a stress run
+ */
+struct StressOptions {
+    // Directory that per-thread working directories are created under
+    std::string baseDir;
+    // Number of threads, or the largest thread count when scaling
+    int threads = 8;
+    // Operations per thread in each round
+    int opsPerThread = 1000;
+    // Size of each written file, at most the 4 KB that readFile() returns
+    size_t fileSize = 1024;
+    // Run rounds with 1, 2, 4, ... threads up to threads
+    bool scale = false;
+};
+
+/**
+ * Outcome of one stress round
+ */
+struct StressRoundResult {
+    int threads = 0;
+    size_t operations = 0;
+    size_t failures = 0;
+    double seconds = 0;
+};
+
+/**
+ * StressRunner class runs N threads x M mixed write/read/list/delete operations
+ * against one shared HdfsClient, verifies every result, and reports throughput
+ * per thread count. Each thread works in its own directory and cycles through
+ * write, read back and compare, list and check, and delete of one file.
+ */
+class StressRunner {
+public:
+    /**
+     * Constructor
+     * @param client Connected client shared by all threads
+     * @param options Stress options
+     */
+    StressRunner(HdfsClient& client, const StressOptions& options);
+
+    /**
+     * Run all rounds and print a scaling report
+     * @return Whether every operation succeeded and verified
+     */
+    bool run();
+
+private:
+    /**
+     * Run one round with a fixed number of threads
+     * @param threads Thread count
+     * @param round Round number, used for the working directory name
+     * @return Round result
+     */
+    StressRoundResult runRound(int threads, int round);
+
+    /**
+     * Operation loop of one thread
+     * @param dir Working directory of this thread
+     * @param threadId Thread index, used in file contents
+     * @param failures Incremented for each failed or mismatching operation
+     */
+    void runThread(const std::string& dir, int threadId, size_t& failures);
+
+    /**
+     * Report a verification failure, only the first few are printed
+     * @param message Failure description
+     */
+    void reportFailure(const std::string& message);
+
+    /**
+     * Print throughput, speedup and a bar chart for each round
+     * @param results Round results
+     */
+    void printReport(const std::vector<StressRoundResult>& results) const;
+
+    HdfsClient& client_;
+    StressOptions options_;
+    // Serializes failure output from worker threads
+    std::mutex outputMutex_;
+    size_t reportedFailures_;
+};
+
+#endif // STRESS_RUNNER_H
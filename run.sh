@@ -9,13 +9,24 @@ show_usage() {
     echo "  --hadoop-conf=PATH    - Set HADOOP_CONF_DIR to PATH"
     echo "  --classpath=PATH      - Set CLASSPATH to PATH"
     echo "  --fs=URI              - Set fs.defaultFS to URI (e.g. hdfs://namenode:8020)"
+    echo "  --profile-startup     - Print timing of config load, JVM init, login and connect"
+    echo "  --buffer-stats        - Print I/O buffer pool statistics on exit"
     echo "  --help                - Show this help message"
     echo ""
     echo "Commands:"
     echo "  list <path>            - List files in directory"
     echo "  read <path>            - Read file content"
+    echo "  tail [opts] <path>...  - Print the end of files"
+    echo "    -f                   - Keep printing appended data until interrupted"
+    echo "    --bytes=N            - Print the last N bytes first (default 1024)"
+    echo "    --interval=MS        - Poll interval while data is arriving (default 100)"
+    echo "    --max-interval=MS    - Longest poll interval while idle (default 5000)"
     echo "  write <path> <content> - Write content to file"
-    echo "  delete <path>          - Delete file"
+    echo "  delete [opts] <path>   - Delete file, or all paths matching a glob (*, ?, [...], **)"
+    echo "    -r                   - Delete directories recursively"
+    echo "    --dry-run            - Only print matching paths"
+    echo "    --max-matches=N      - Refuse if more than N paths match (default 10000, 0 = no limit)"
+    echo "    --parallelism=N      - Number of concurrent delete connections (default 8)"
     echo ""
     echo "Examples:"
     echo "  $0 --hadoop-home=/path/to/hadoop list /user/hadoop"
@@ -0,0 +1,350 @@
+#include "buffer_pool.h"
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <sys/mman.h>
+
+const size_t BufferPool::kMinClassSize;
+const int BufferPool::kNumClasses;
+const size_t BufferPool::kSlabSize;
+const size_t BufferPool::kThreadCacheMaxSize;
+const size_t BufferPool::kThreadCacheDepth;
+const size_t BufferPool::kThreadCacheBytes;
+const size_t BufferPool::kDefaultCapacity;
+
+BufferPool::Buffer::Buffer() : data_(nullptr), capacity_(0), sizeClass_(0) {
+}
+
+BufferPool::Buffer::Buffer(char* data, size_t capacity, int sizeClass)
+    : data_(data), capacity_(capacity), sizeClass_(sizeClass) {
+}
+
+BufferPool::Buffer::~Buffer() {
+    release();
+}
+
+BufferPool::Buffer::Buffer(Buffer&& other)
+    : data_(other.data_), capacity_(other.capacity_), sizeClass_(other.sizeClass_) {
+    other.data_ = nullptr;
+    other.capacity_ = 0;
+}
+
+BufferPool::Buffer& BufferPool::Buffer::operator=(Buffer&& other) {
+    if (this != &other) {
+        release();
+        data_ = other.data_;
+        capacity_ = other.capacity_;
+        sizeClass_ = other.sizeClass_;
+        other.data_ = nullptr;
+        other.capacity_ = 0;
+    }
+    return *this;
+}
+
+void BufferPool::Buffer::release() {
+    if (data_) {
+        BufferPool::instance().release(data_, capacity_, sizeClass_);
+        data_ = nullptr;
+        capacity_ = 0;
+    }
+}
+
+BufferPool::ThreadCache::~ThreadCache() {
+    BufferPool& pool = BufferPool::instance();
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+    for (int i = 0; i < kNumClasses; i++) {
+        for (char* data : buffers[i]) {
+            pool.pushFreeLocked(i, data);
+        }
+        buffers[i].clear();
+    }
+    bytes = 0;
+}
+
+BufferPool& BufferPool::instance() {
+    // Never destroyed, so buffers and thread caches released during exit stay valid
+    static BufferPool* pool = new BufferPool();
+    return *pool;
+}
+
+BufferPool::BufferPool()
+    : capacity_(kDefaultCapacity), inUseBytes_(0), reservedBytes_(0), inUseBuffers_(0), waiters_(0),
+      acquires_(0), threadCacheHits_(0), sharedHits_(0), osAllocations_(0), waits_(0), failures_(0) {
+}
+
+BufferPool::ThreadCache& BufferPool::threadCache() {
+    thread_local ThreadCache cache;
+    return cache;
+}
+
+int BufferPool::sizeClassFor(size_t size) {
+    int sizeClass = 0;
+    while (sizeClass < kNumClasses && classSize(sizeClass) < size) {
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+size_t BufferPool::classSize(int sizeClass) {
+    return kMinClassSize << sizeClass;
+}
+
+BufferPool::Buffer BufferPool::acquire(size_t size) {
+    return acquireImpl(size, false, std::chrono::milliseconds(0));
+}
+
+BufferPool::Buffer BufferPool::tryAcquire(size_t size, std::chrono::milliseconds timeout) {
+    return acquireImpl(size, true, timeout);
+}
+
+void BufferPool::setCapacity(size_t bytes) {
+    capacity_ = bytes;
+    std::lock_guard<std::mutex> lock(mutex_);
+    // A smaller capacity may leave idle memory above it
+    trimLocked(bytes);
+    // A larger capacity may unblock waiters
+    released_.notify_all();
+}
+
+bool BufferPool::tryReserve(size_t bytes) {
+    size_t current = inUseBytes_.load();
+    do {
+        // Always admit a request when nothing is in use, so oversized requests cannot deadlock
+        if (current != 0 && current + bytes > capacity_.load()) {
+            return false;
+        }
+    } while (!inUseBytes_.compare_exchange_weak(current, current + bytes));
+    return true;
+}
+
+BufferPool::Buffer BufferPool::acquireImpl(size_t size, bool hasTimeout, std::chrono::milliseconds timeout) {
+    int sizeClass = sizeClassFor(size);
+    size_t bytes;
+    if (sizeClass < kNumClasses) {
+        bytes = classSize(sizeClass);
+    } else {
+        // Direct allocation rounded up to whole pages
+        bytes = (size + kMinClassSize - 1) / kMinClassSize * kMinClassSize;
+    }
+
+    // Backpressure: wait for other buffers to be released while at capacity
+    if (!tryReserve(bytes)) {
+        waits_++;
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiters_++;
+        bool reserved;
+        if (hasTimeout) {
+            reserved = released_.wait_for(lock, timeout, [this, bytes]() { return tryReserve(bytes); });
+        } else {
+            released_.wait(lock, [this, bytes]() { return tryReserve(bytes); });
+            reserved = true;
+        }
+        waiters_--;
+        if (!reserved) {
+            failures_++;
+            return Buffer();
+        }
+    }
+
+    char* data = nullptr;
+    if (bytes <= kThreadCacheMaxSize) {
+        ThreadCache& cache = threadCache();
+        std::vector<char*>& cached = cache.buffers[sizeClass];
+        if (!cached.empty()) {
+            data = cached.back();
+            cached.pop_back();
+            cache.bytes -= bytes;
+            threadCacheHits_++;
+        }
+    }
+
+    if (!data) {
+        data = takeShared(sizeClass, bytes);
+    }
+
+    if (!data) {
+        inUseBytes_ -= bytes;
+        failures_++;
+        std::cerr << "Failed to allocate " << bytes << " byte buffer" << std::endl;
+        return Buffer();
+    }
+
+    inUseBuffers_++;
+    acquires_++;
+    return Buffer(data, bytes, sizeClass);
+}
+
+char* BufferPool::takeShared(int sizeClass, size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sizeClass < kNumClasses) {
+        char* data = popFreeLocked(sizeClass);
+        if (data) {
+            sharedHits_++;
+            return data;
+        }
+    }
+
+    // Make room under the capacity before taking more memory from the OS
+    size_t allocation = (bytes < kSlabSize) ? kSlabSize : bytes;
+    size_t capacity = capacity_.load();
+    if (reservedBytes_.load() + allocation > capacity) {
+        trimLocked(capacity > allocation ? capacity - allocation : 0);
+    }
+
+    if (bytes < kSlabSize) {
+        // Carve a new slab into buffers of this class
+        char* slab = allocateAligned(kSlabSize);
+        if (!slab) {
+            return nullptr;
+        }
+        Slab& info = slabs_[slab];
+        info.sizeClass = sizeClass;
+        info.freeBuffers = 0;
+        for (size_t offset = bytes; offset < kSlabSize; offset += bytes) {
+            pushFreeLocked(sizeClass, slab + offset);
+        }
+        return slab;
+    }
+
+    return allocateAligned(bytes);
+}
+
+void BufferPool::pushFreeLocked(int sizeClass, char* data) {
+    freeLists_[sizeClass].push_back(data);
+    if (classSize(sizeClass) < kSlabSize) {
+        // Slab starting at or before data
+        std::map<char*, Slab>::iterator slab = --slabs_.upper_bound(data);
+        slab->second.freeBuffers++;
+    }
+}
+
+char* BufferPool::popFreeLocked(int sizeClass) {
+    std::vector<char*>& freeList = freeLists_[sizeClass];
+    if (freeList.empty()) {
+        return nullptr;
+    }
+    char* data = freeList.back();
+    freeList.pop_back();
+    if (classSize(sizeClass) < kSlabSize) {
+        std::map<char*, Slab>::iterator slab = --slabs_.upper_bound(data);
+        slab->second.freeBuffers--;
+    }
+    return data;
+}
+
+void BufferPool::trimLocked(size_t limit) {
+    // Large buffers first, each one frees its whole size
+    for (int sizeClass = kNumClasses - 1; sizeClass >= 0 && reservedBytes_.load() > limit; sizeClass--) {
+        size_t bytes = classSize(sizeClass);
+        if (bytes < kSlabSize) {
+            break;
+        }
+        std::vector<char*>& freeList = freeLists_[sizeClass];
+        while (!freeList.empty() && reservedBytes_.load() > limit) {
+            free(freeList.back());
+            freeList.pop_back();
+            reservedBytes_ -= bytes;
+        }
+    }
+
+    // Then slabs whose buffers are all idle on the shared free list
+    std::map<char*, Slab>::iterator slab = slabs_.begin();
+    while (slab != slabs_.end() && reservedBytes_.load() > limit) {
+        char* start = slab->first;
+        size_t bytes = classSize(slab->second.sizeClass);
+        if (slab->second.freeBuffers < kSlabSize / bytes) {
+            ++slab;
+            continue;
+        }
+        std::vector<char*>& freeList = freeLists_[slab->second.sizeClass];
+        freeList.erase(std::remove_if(freeList.begin(), freeList.end(), [start](char* data) {
+            return data >= start && data < start + kSlabSize;
+        }), freeList.end());
+        free(start);
+        reservedBytes_ -= kSlabSize;
+        slab = slabs_.erase(slab);
+    }
+}
+
+char* BufferPool::allocateAligned(size_t bytes) {
+    // Huge-page alignment lets the kernel back whole slabs with transparent huge pages
+    size_t alignment = (bytes >= kSlabSize) ? kSlabSize : kMinClassSize;
+    void* memory = nullptr;
+    if (posix_memalign(&memory, alignment, bytes) != 0) {
+        return nullptr;
+    }
+#ifdef MADV_HUGEPAGE
+    if (bytes >= kSlabSize) {
+        madvise(memory, bytes, MADV_HUGEPAGE);
+    }
+#endif
+    osAllocations_++;
+    reservedBytes_ += bytes;
+    return static_cast<char*>(memory);
+}
+
+void BufferPool::release(char* data, size_t capacity, int sizeClass) {
+    inUseBytes_ -= capacity;
+    inUseBuffers_--;
+
+    if (capacity <= kThreadCacheMaxSize) {
+        ThreadCache& cache = threadCache();
+        std::vector<char*>& cached = cache.buffers[sizeClass];
+        if (cached.size() < kThreadCacheDepth && cache.bytes + capacity <= kThreadCacheBytes) {
+            cached.push_back(data);
+            cache.bytes += capacity;
+            data = nullptr;
+        }
+    }
+
+    if (data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (sizeClass < kNumClasses) {
+            pushFreeLocked(sizeClass, data);
+            // Give idle memory back while reserved memory is over the capacity
+            size_t limit = capacity_.load();
+            if (reservedBytes_.load() > limit) {
+                trimLocked(limit);
+            }
+        } else {
+            // Direct allocations are never reused
+            free(data);
+            reservedBytes_ -= capacity;
+        }
+    }
+
+    if (waiters_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        released_.notify_all();
+    }
+}
+
+BufferPoolStats BufferPool::stats() const {
+    BufferPoolStats stats;
+    stats.capacityBytes = capacity_;
+    stats.inUseBytes = inUseBytes_;
+    stats.reservedBytes = reservedBytes_;
+    stats.inUseBuffers = inUseBuffers_;
+    stats.acquires = acquires_;
+    stats.threadCacheHits = threadCacheHits_;
+    stats.sharedHits = sharedHits_;
+    stats.osAllocations = osAllocations_;
+    stats.waits = waits_;
+    stats.failures = failures_;
+    return stats;
+}
+
+void BufferPool::printStats(std::ostream& out) const {
+    BufferPoolStats current = stats();
+    out << "Buffer pool statistics:" << std::endl;
+    out << "  capacity bytes:     " << current.capacityBytes << std::endl;
+    out << "  in-use bytes:       " << current.inUseBytes << std::endl;
+    out << "  in-use buffers:     " << current.inUseBuffers << std::endl;
+    out << "  reserved bytes:     " << current.reservedBytes << std::endl;
+    out << "  acquires:           " << current.acquires << std::endl;
+    out << "  thread cache hits:  " << current.threadCacheHits << std::endl;
+    out << "  shared hits:        " << current.sharedHits << std::endl;
+    out << "  OS allocations:     " << current.osAllocations << std::endl;
+    out << "  capacity waits:     " << current.waits << std::endl;
+    out << "  failures:           " << current.failures << std::endl;
+}
@@ -4,7 +4,7 @@
 #include <sstream>
 #include <algorithm>
 
-ConfigLoader::ConfigLoader() {
+ConfigLoader::ConfigLoader() : verbose_(true) {
     // Initialize configuration mapping
 }
 
@@ -36,10 +36,16 @@ bool ConfigLoader::loadFromFile(const std::string& configPath) {
     
     configFile.close();
     
-    std::cout << "Loaded " << configs_.size() << " configuration items from " << configPath << std::endl;
+    if (verbose_) {
+        std::cout << "Loaded " << configs_.size() << " configuration items from " << configPath << std::endl;
+    }
     return success;
 }
 
+void ConfigLoader::setVerbose(bool verbose) {
+    verbose_ = verbose;
+}
+
 bool ConfigLoader::parseLine(const std::string& line) {
     std::istringstream iss(line);
     std::string key, value;
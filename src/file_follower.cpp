@@ -0,0 +1,150 @@
+#include "file_follower.h"
+#include "buffer_pool.h"
+#include <iostream>
+#include <fcntl.h>
+#include <algorithm>
+
+namespace {
+
+// Size of each positional read
+const tSize kReadChunkSize = 64 * 1024;
+// Bytes delivered per poll before yielding to other files
+const size_t kMaxBytesPerPoll = 4 * 1024 * 1024;
+
+}  // namespace
+
+FileFollower::FileFollower(hdfsFS fs, const std::string& path, size_t initialBytes,
+                           std::chrono::milliseconds minInterval, std::chrono::milliseconds maxInterval)
+    : fs_(fs), path_(path), file_(nullptr), offset_(-1), initialBytes_(initialBytes),
+      minInterval_(minInterval), maxInterval_(std::max(minInterval, maxInterval)), interval_(minInterval),
+      nextPoll_(std::chrono::steady_clock::now()), missing_(false),
+      truncatedPoll_(false) {
+}
+
+FileFollower::~FileFollower() {
+    close();
+}
+
+size_t FileFollower::poll(const DataSink& sink) {
+    size_t delivered = 0;
+    bool failed = false;
+
+    // Bytes the open stream already knows about need no reopen
+    if (file_) {
+        delivered = readAppended(sink, failed);
+    }
+
+    // Stream exhausted or failed: reopen to refresh the visible length
+    if (delivered == 0) {
+        failed = false;
+        if (reopen()) {
+            delivered = readAppended(sink, failed);
+        }
+    }
+
+    if (failed) {
+        close();
+    }
+
+    // Back off while idle, poll again right away if this poll hit its byte limit
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    truncatedPoll_ = (delivered >= kMaxBytesPerPoll);
+    if (truncatedPoll_) {
+        interval_ = minInterval_;
+        nextPoll_ = now;
+    } else {
+        interval_ = (delivered > 0) ? minInterval_ : std::min(interval_ * 2, maxInterval_);
+        nextPoll_ = now + interval_;
+    }
+
+    return delivered;
+}
+
+bool FileFollower::truncatedPoll() const {
+    return truncatedPoll_;
+}
+
+std::chrono::steady_clock::time_point FileFollower::nextPoll() const {
+    return nextPoll_;
+}
+
+const std::string& FileFollower::path() const {
+    return path_;
+}
+
+bool FileFollower::missing() const {
+    return missing_;
+}
+
+bool FileFollower::reopen() {
+    close();
+
+    file_ = hdfsOpenFile(fs_, path_.c_str(), O_RDONLY, 0, 0, 0);
+    if (!file_) {
+        if (!missing_) {
+            // Reported once, later polls keep retrying until the file appears
+            std::cerr << "Cannot open " << path_ << std::endl;
+            missing_ = true;
+        }
+        return false;
+    }
+    missing_ = false;
+
+    if (offset_ < 0) {
+        // NameNode length covers completed blocks, available() adds the block being written
+        tOffset length = 0;
+        hdfsFileInfo* fileInfo = hdfsGetPathInfo(fs_, path_.c_str());
+        if (fileInfo) {
+            length = fileInfo->mSize;
+            hdfsFreeFileInfo(fileInfo, 1);
+        }
+        if (hdfsSeek(fs_, file_, length) == 0) {
+            int available = hdfsAvailable(fs_, file_);
+            if (available > 0) {
+                length += available;
+            }
+        }
+        tOffset initial = static_cast<tOffset>(initialBytes_);
+        offset_ = (length > initial) ? length - initial : 0;
+    } else if (hdfsSeek(fs_, file_, offset_) != 0) {
+        // Seeking past the visible end means the file shrank
+        std::cerr << path_ << ": file truncated, following from the start" << std::endl;
+        offset_ = 0;
+    }
+
+    return true;
+}
+
+size_t FileFollower::readAppended(const DataSink& sink, bool& failed) {
+    BufferPool::Buffer buffer = BufferPool::instance().acquire(kReadChunkSize);
+    if (!buffer.valid()) {
+        failed = true;
+        return 0;
+    }
+
+    size_t delivered = 0;
+    while (delivered < kMaxBytesPerPoll) {
+        tSize bytesRead = hdfsPread(fs_, file_, offset_, buffer.data(), kReadChunkSize);
+        if (bytesRead < 0) {
+            // Typically the last block changed under lease recovery, reopen on the next poll
+            std::cerr << "Failed to read " << path_ << " at offset " << offset_ << std::endl;
+            failed = true;
+            break;
+        }
+        if (bytesRead == 0) {
+            break;
+        }
+        sink(path_, buffer.data(), bytesRead);
+        offset_ += bytesRead;
+        delivered += bytesRead;
+    }
+
+    return delivered;
+}
+
+void FileFollower::close() {
+    if (file_) {
+        hdfsCloseFile(fs_, file_);
+        file_ = nullptr;
+    }
+}
@@ -0,0 +1,219 @@
+#include "glob_pattern.h"
+
+GlobPattern::GlobPattern(const std::string& pattern) {
+    std::string path = pattern;
+
+    // Keep scheme://authority out of component matching
+    size_t schemePos = pattern.find("://");
+    if (schemePos != std::string::npos) {
+        size_t pathPos = pattern.find('/', schemePos + 3);
+        if (pathPos == std::string::npos) {
+            authority_ = pattern;
+            path.clear();
+        } else {
+            authority_ = pattern.substr(0, pathPos);
+            path = pattern.substr(pathPos);
+        }
+        root_ = authority_;
+    }
+
+    if (!path.empty() && path[0] == '/') {
+        root_ += "/";
+    }
+
+    // Split remaining path on '/', ignoring empty components
+    size_t start = 0;
+    while (start <= path.size()) {
+        size_t end = path.find('/', start);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        if (end > start) {
+            components_.push_back(path.substr(start, end - start));
+        }
+        start = end + 1;
+    }
+}
+
+const std::string& GlobPattern::root() const {
+    return root_;
+}
+
+const std::string& GlobPattern::authority() const {
+    return authority_;
+}
+
+const std::vector<std::string>& GlobPattern::components() const {
+    return components_;
+}
+
+bool GlobPattern::hasWildcard(const std::string& text) {
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\\') {
+            i++;  // Skip escaped character
+        } else if (text[i] == '*' || text[i] == '?' || text[i] == '[') {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GlobPattern::isRecursiveWildcard(const std::string& component) {
+    return component == "**";
+}
+
+bool GlobPattern::matchBracket(const std::string& pattern, size_t& pos, char c, bool& matched) {
+    size_t i = pos + 1;
+    bool negate = false;
+    if (i < pattern.size() && (pattern[i] == '!' || pattern[i] == '^')) {
+        negate = true;
+        i++;
+    }
+
+    bool found = false;
+    bool first = true;
+    while (i < pattern.size() && (first || pattern[i] != ']')) {
+        first = false;
+        char low = pattern[i];
+        if (low == '\\' && i + 1 < pattern.size()) {
+            low = pattern[++i];
+        }
+        i++;
+
+        char high = low;
+        // Range such as a-z, a trailing '-' is taken literally
+        if (i + 1 < pattern.size() && pattern[i] == '-' && pattern[i + 1] != ']') {
+            high = pattern[i + 1];
+            if (high == '\\' && i + 2 < pattern.size()) {
+                high = pattern[i + 2];
+                i++;
+            }
+            i += 2;
+        }
+
+        if (c >= low && c <= high) {
+            found = true;
+        }
+    }
+
+    if (i >= pattern.size()) {
+        return false;  // No closing bracket
+    }
+
+    pos = i + 1;
+    matched = (found != negate);
+    return true;
+}
+
+bool GlobPattern::matchComponent(const std::string& pattern, const std::string& name) {
+    size_t p = 0;
+    size_t n = 0;
+    // Position after the last '*' seen and the name position it was tried at
+    size_t starP = std::string::npos;
+    size_t starN = 0;
+
+    while (n < name.size()) {
+        bool advanced = false;
+
+        if (p < pattern.size()) {
+            char ch = pattern[p];
+            if (ch == '*') {
+                starP = ++p;
+                starN = n;
+                continue;
+            } else if (ch == '?') {
+                p++;
+                n++;
+                advanced = true;
+            } else if (ch == '[') {
+                size_t next = p;
+                bool matched = false;
+                if (matchBracket(pattern, next, name[n], matched)) {
+                    if (matched) {
+                        p = next;
+                        n++;
+                        advanced = true;
+                    }
+                } else if (name[n] == '[') {
+                    // Unterminated bracket is matched literally
+                    p++;
+                    n++;
+                    advanced = true;
+                }
+            } else if (ch == '\\' && p + 1 < pattern.size()) {
+                if (pattern[p + 1] == name[n]) {
+                    p += 2;
+                    n++;
+                    advanced = true;
+                }
+            } else if (ch == name[n]) {
+                p++;
+                n++;
+                advanced = true;
+            }
+        }
+
+        if (!advanced) {
+            if (starP == std::string::npos) {
+                return false;
+            }
+            // Let the last '*' consume one more character
+            p = starP;
+            n = ++starN;
+        }
+    }
+
+    while (p < pattern.size() && pattern[p] == '*') {
+        p++;
+    }
+    return p == pattern.size();
+}
+
+std::string GlobPattern::unescape(const std::string& component) {
+    std::string result;
+    for (size_t i = 0; i < component.size(); i++) {
+        if (component[i] == '\\' && i + 1 < component.size()) {
+            i++;
+        }
+        result += component[i];
+    }
+    return result;
+}
+
+std::string GlobPattern::join(const std::string& parent, const std::string& name) {
+    if (parent.empty()) {
+        return name;
+    }
+    if (parent[parent.size() - 1] == '/') {
+        return parent + name;
+    }
+    return parent + "/" + name;
+}
+
+std::string GlobPattern::pathOf(const std::string& uri) {
+    size_t slash = uri.find('/');
+    size_t colon = uri.find(':');
+    // No scheme before the first '/', already a plain path
+    if (colon == std::string::npos || (slash != std::string::npos && colon > slash)) {
+        return uri;
+    }
+
+    size_t pathPos = colon + 1;
+    if (uri.compare(pathPos, 2, "//") == 0) {
+        pathPos = uri.find('/', pathPos + 2);
+        if (pathPos == std::string::npos) {
+            return "/";
+        }
+    }
+    return uri.substr(pathPos);
+}
+
+std::string GlobPattern::baseName(const std::string& path) {
+    size_t end = path.find_last_not_of('/');
+    if (end == std::string::npos) {
+        return "";
+    }
+    size_t start = path.find_last_of('/', end);
+    start = (start == std::string::npos) ? 0 : start + 1;
+    return path.substr(start, end - start + 1);
+}
@@ -2,7 +2,7 @@
 #include <iostream>
 #include <cstring>
 
-HdfsBuilder::HdfsBuilder() : useDefault_(false) {
+HdfsBuilder::HdfsBuilder() : useDefault_(false), verbose_(true) {
     // Create a new hdfsBuilder instance
     builder_ = hdfsNewBuilder();
     if (!builder_) {
@@ -15,7 +15,9 @@ HdfsBuilder::~HdfsBuilder() {
     // Note: When connect() calls hdfsBuilderConnect, the builder is automatically released
     // Therefore, manual release is only needed when builder_ is not null and connect hasn't been called
     if (builder_) {
-        std::cout << "Freeing unused builder" << std::endl;
+        if (verbose_) {
+            std::cout << "Freeing unused builder" << std::endl;
+        }
         hdfsFreeBuilder(builder_);
         builder_ = nullptr;
     }
@@ -71,7 +73,9 @@ HdfsBuilder& HdfsBuilder::applyConfigs(const ConfigLoader& configLoader) {
     if (builder_) {
         const auto& configs = configLoader.getAllConfigs();
         for (const auto& config : configs) {
-            std::cout << "Applying configuration: " << config.first << " = " << config.second << std::endl;
+            if (verbose_) {
+                std::cout << "Applying configuration: " << config.first << " = " << config.second << std::endl;
+            }
             hdfsBuilderConfSetStr(builder_, config.first.c_str(), config.second.c_str());
         }
     } else {
@@ -82,7 +86,9 @@ HdfsBuilder& HdfsBuilder::applyConfigs(const ConfigLoader& configLoader) {
 
 HdfsBuilder& HdfsBuilder::setPrincipal(const std::string& principal) {
     if (builder_) {
-        std::cout << "Setting Kerberos principal: " << principal << std::endl;
+        if (verbose_) {
+            std::cout << "Setting Kerberos principal: " << principal << std::endl;
+        }
         hdfsBuilderSetPrincipal(builder_, principal.c_str());
     } else {
         std::cerr << "Error: Builder not initialized" << std::endl;
@@ -92,7 +98,9 @@ HdfsBuilder& HdfsBuilder::setPrincipal(const std::string& principal) {
 
 HdfsBuilder& HdfsBuilder::setKrb5Conf(const std::string& krb5Conf) {
     if (builder_) {
-        std::cout << "Setting Kerberos krb5.conf file: " << krb5Conf << std::endl;
+        if (verbose_) {
+            std::cout << "Setting Kerberos krb5.conf file: " << krb5Conf << std::endl;
+        }
         hdfsBuilderSetKerb5Conf(builder_, krb5Conf.c_str());
     } else {
         std::cerr << "Error: Builder not initialized" << std::endl;
@@ -102,7 +110,9 @@ HdfsBuilder& HdfsBuilder::setKrb5Conf(const std::string& krb5Conf) {
 
 HdfsBuilder& HdfsBuilder::setKeyTabFile(const std::string& keytabFile) {
     if (builder_) {
-        std::cout << "Setting Kerberos keytab file: " << keytabFile << std::endl;
+        if (verbose_) {
+            std::cout << "Setting Kerberos keytab file: " << keytabFile << std::endl;
+        }
         hdfsBuilderSetKeyTabFile(builder_, keytabFile.c_str());
     } else {
         std::cerr << "Error: Builder not initialized" << std::endl;
@@ -110,6 +120,11 @@ HdfsBuilder& HdfsBuilder::setKeyTabFile(const std::string& keytabFile) {
     return *this;
 }
 
+HdfsBuilder& HdfsBuilder::setVerbose(bool verbose) {
+    verbose_ = verbose;
+    return *this;
+}
+
 hdfsFS HdfsBuilder::connect() {
     if (!builder_) {
         std::cerr << "Error: Builder not initialized" << std::endl;
@@ -117,7 +132,7 @@ hdfsFS HdfsBuilder::connect() {
     }
     
     // If set to use default configuration
-    if (useDefault_) {
+    if (useDefault_ && verbose_) {
         std::cout << "Using default HDFS configuration" << std::endl;
     }
 
@@ -130,7 +145,7 @@ hdfsFS HdfsBuilder::connect() {
     
     if (!fs) {
         std::cerr << "Failed to connect to HDFS" << std::endl;
-    } else {
+    } else if (verbose_) {
         std::cout << "Successfully connected to HDFS" << std::endl;
     }
     
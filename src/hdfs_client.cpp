@@ -1,21 +1,69 @@
 #include "hdfs_client.h"
 #include "hdfs_builder.h"
+#include "glob_pattern.h"
+#include "buffer_pool.h"
 #include <iostream>
 #include <fcntl.h>
 #include <vector>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <algorithm>
+#include <memory>
+#include <cerrno>
 #include <cstring>
 #include <cstdlib> // For using getenv function
 
-HdfsClient::HdfsClient() : fs_(nullptr), connected_(false) {
+HdfsClient::HdfsClient()
+    : fs_(nullptr), connected_(false), configLoaded_(false), verbose_(true), profiler_(nullptr) {
 }
 
 HdfsClient::~HdfsClient() {
     disconnect();
 }
 
+void HdfsClient::setStartupProfiler(StartupProfiler* profiler) {
+    profiler_ = profiler;
+}
+
+void HdfsClient::setVerbose(bool verbose) {
+    verbose_ = verbose;
+}
+
+void HdfsClient::warmUp() {
+    std::unique_lock<std::shared_timed_mutex> lock(stateMutex_);
+    startWarmUp();
+}
+
+void HdfsClient::startWarmUp() {
+    if (jvmWarmup_.valid()) {
+        return;
+    }
+
+    // libhdfs creates the JVM lazily on first use. Reading a configuration value
+    // forces JVM creation and loads the Hadoop Configuration classes. The time
+    // it takes is reported as jvm_init, and jvm_wait shows what was not overlapped.
+    StartupProfiler* profiler = profiler_.load();
+    jvmWarmup_ = std::async(std::launch::async, [profiler]() {
+        StartupProfiler::Scope scope(profiler, "jvm_init");
+        char* value = nullptr;
+        if (hdfsConfGetStr("fs.defaultFS", &value) != 0) {
+            return false;
+        }
+        hdfsConfStrFree(value);
+        return true;
+    });
+}
+
 bool HdfsClient::connect() {
-        // Use ConfigLoader to load client.conf
-    ConfigLoader configLoader;
+    std::unique_lock<std::shared_timed_mutex> lock(stateMutex_);
+
+    // Boot the JVM in the background while client.conf is loaded
+    startWarmUp();
+
+    // Use ConfigLoader to load client.conf
     std::string confPath;
     // If configuration file path is not specified, use default path
     if (confPath.empty()) {
@@ -28,28 +76,63 @@ bool HdfsClient::connect() {
         }
     }
     
-    std::cout << "Loading client configuration from " << confPath << std::endl;
-    bool configLoaded = configLoader.loadFromFile(confPath);
+    bool verbose = verbose_;
+    if (verbose) {
+        std::cout << "Loading client configuration from " << confPath << std::endl;
+    }
+    {
+        StartupProfiler::Scope scope(profiler_.load(), "config_load");
+        configLoader_.setVerbose(verbose);
+        configLoaded_ = configLoader_.loadFromFile(confPath);
+    }
     
-    if (!configLoaded) {
-        std::cout << "Warning: Could not load client configuration from " << confPath << std::endl;
-    } else {
+    if (!configLoaded_) {
+        std::cerr << "Warning: Could not load client configuration from " << confPath << std::endl;
+    } else if (verbose) {
         // Print all loaded configurations
-        configLoader.printConfigs();
+        configLoader_.printConfigs();
     }
     
-    // Use HdfsBuilder to create connection
-    HdfsBuilder builder;
-    
     // First try to read HDFS_DEFAULT_FS from environment variable
     const char* defaultFs = std::getenv("HDFS_DEFAULT_FS");
     if (defaultFs == nullptr || strlen(defaultFs) == 0) {
         std::cerr << "HDFS_DEFAULT_FS is not set" << std::endl;
         return false;
     }
-    std::string hdfsUri = defaultFs;
-    std::cout << "HDFS_DEFAULT_FS is: " << hdfsUri << std::endl;
-    builder.setNameNode(hdfsUri);
+    defaultFs_ = defaultFs;
+    if (verbose) {
+        std::cout << "HDFS_DEFAULT_FS is: " << defaultFs_ << std::endl;
+    }
+    
+    // Wait for the background JVM boot; any time spent here was not overlapped
+    {
+        StartupProfiler::Scope scope(profiler_.load(), "jvm_wait");
+        if (!jvmWarmup_.get()) {
+            std::cerr << "Warning: JVM warm-up failed, retrying during connect" << std::endl;
+        }
+    }
+
+    // Connect to HDFS, libhdfs performs the Kerberos keytab login inside hdfsBuilderConnect
+    bool kerberos = configLoaded_ &&
+        configLoader_.getConfigValue("hadoop.security.authentication") == "kerberos";
+    {
+        StartupProfiler::Scope scope(profiler_.load(), kerberos ? "login+connect" : "connect");
+        fs_ = openConnection(verbose);
+    }
+    connected_ = (fs_ != nullptr);
+    
+    if (!connected_) {
+        std::cerr << "Failed to connect to HDFS using builder" << std::endl;
+    }
+    
+    return connected_;
+}
+
+hdfsFS HdfsClient::openConnection(bool verbose) {
+    // Use HdfsBuilder to create connection
+    HdfsBuilder builder;
+    builder.setVerbose(verbose);
+    builder.setNameNode(defaultFs_);
 
     // Configure necessary filesystem implementation classes
     builder.setConfig("fs.hdfs.impl", "org.apache.hadoop.hdfs.DistributedFileSystem");
@@ -61,21 +144,25 @@ bool HdfsClient::connect() {
     std::string krb5Conf;
 
     // Apply configurations from client.conf - this will override previous configurations
-    if (configLoaded) {
-        builder.applyConfigs(configLoader);
+    if (configLoaded_) {
+        builder.applyConfigs(configLoader_);
         
         // Check if Kerberos authentication related configurations are set
-        if (configLoader.hasConfig("hadoop.security.authentication") && 
-            configLoader.getConfigValue("hadoop.security.authentication") == "kerberos") {
-            std::cout << "Kerberos authentication is enabled in configuration" << std::endl;
+        if (configLoader_.hasConfig("hadoop.security.authentication") && 
+            configLoader_.getConfigValue("hadoop.security.authentication") == "kerberos") {
+            if (verbose) {
+                std::cout << "Kerberos authentication is enabled in configuration" << std::endl;
+            }
             
             // Check if principal and keytab are provided
-            if (configLoader.hasConfig("hadoop.kerberos.principal") && configLoader.hasConfig("hadoop.kerberos.keytab")) {
-                principal = configLoader.getConfigValue("hadoop.kerberos.principal");
-                keytabFile = configLoader.getConfigValue("hadoop.kerberos.keytab");
+            if (configLoader_.hasConfig("hadoop.kerberos.principal") && configLoader_.hasConfig("hadoop.kerberos.keytab")) {
+                principal = configLoader_.getConfigValue("hadoop.kerberos.principal");
+                keytabFile = configLoader_.getConfigValue("hadoop.kerberos.keytab");
                 
-                std::cout << "Using Kerberos principal: " << principal << std::endl;
-                std::cout << "Using Kerberos keytab file: " << keytabFile << std::endl;
+                if (verbose) {
+                    std::cout << "Using Kerberos principal: " << principal << std::endl;
+                    std::cout << "Using Kerberos keytab file: " << keytabFile << std::endl;
+                }
                 
                 builder.setPrincipal(principal);
                 builder.setKeyTabFile(keytabFile);
@@ -83,38 +170,45 @@ bool HdfsClient::connect() {
                 std::cerr << "Kerberos authentication is enabled, but principal or keytab is missing in configuration" << std::endl;
             }
 
-            if (configLoader.hasConfig("hadoop.kerberos.krb5.conf")) {
-                krb5Conf = configLoader.getConfigValue("hadoop.kerberos.krb5.conf");
-                std::cout << "Using Kerberos krb5.conf file: " << krb5Conf << std::endl;
+            if (configLoader_.hasConfig("hadoop.kerberos.krb5.conf")) {
+                krb5Conf = configLoader_.getConfigValue("hadoop.kerberos.krb5.conf");
+                if (verbose) {
+                    std::cout << "Using Kerberos krb5.conf file: " << krb5Conf << std::endl;
+                }
                 builder.setKrb5Conf(krb5Conf);
             }
         }
     }
     
-    std::cout << "FileSystem implementation set to: org.apache.hadoop.hdfs.DistributedFileSystem" << std::endl;
-    
-    // Connect to HDFS
-    fs_ = builder.connect();
-    connected_ = (fs_ != nullptr);
-    
-    if (!connected_) {
-        std::cerr << "Failed to connect to HDFS using builder" << std::endl;
+    if (verbose) {
+        std::cout << "FileSystem implementation set to: org.apache.hadoop.hdfs.DistributedFileSystem" << std::endl;
     }
     
-    return connected_;
+    return builder.connect();
 }
 
 void HdfsClient::disconnect() {
+    std::unique_lock<std::shared_timed_mutex> lock(stateMutex_);
+
     if (connected_ && fs_) {
-        std::cout << "Disconnecting from HDFS" << std::endl;
+        if (verbose_) {
+            std::cout << "Disconnecting from HDFS" << std::endl;
+        }
         
         hdfsDisconnect(fs_);
         fs_ = nullptr;
         connected_ = false;
     }
+
+    for (hdfsFS pooled : pool_) {
+        hdfsDisconnect(pooled);
+    }
+    pool_.clear();
 }
 
 std::vector<std::string> HdfsClient::listDirectory(const std::string& path) {
+    std::shared_lock<std::shared_timed_mutex> lock(stateMutex_);
+
     std::vector<std::string> result;
     
     if (!connected_ || !fs_) {
@@ -122,7 +216,9 @@ std::vector<std::string> HdfsClient::listDirectory(const std::string& path) {
         return result;
     }
     
-    std::cout << "Listing directory: " << path << std::endl;
+    if (verbose_) {
+        std::cout << "Listing directory: " << path << std::endl;
+    }
     
     int numEntries = 0;
     hdfsFileInfo* fileInfo = hdfsListDirectory(fs_, path.c_str(), &numEntries);
@@ -140,12 +236,27 @@ std::vector<std::string> HdfsClient::listDirectory(const std::string& path) {
 }
 
 bool HdfsClient::readFile(const std::string& path, std::string& content) {
+    BufferPool::Buffer buffer;
+    size_t length = 0;
+    if (!readFile(path, buffer, length)) {
+        return false;
+    }
+    content.assign(buffer.data(), length);
+    return true;
+}
+
+bool HdfsClient::readFile(const std::string& path, BufferPool::Buffer& buffer, size_t& length) {
+    length = 0;
+    std::shared_lock<std::shared_timed_mutex> lock(stateMutex_);
+
     if (!connected_ || !fs_) {
         std::cerr << "Not connected to HDFS" << std::endl;
         return false;
     }
     
-    std::cout << "Reading file: " << path << std::endl;
+    if (verbose_) {
+        std::cout << "Reading file: " << path << std::endl;
+    }
     
     hdfsFile file = hdfsOpenFile(fs_, path.c_str(), O_RDONLY, 0, 0, 0);
     if (!file) {
@@ -167,7 +278,12 @@ bool HdfsClient::readFile(const std::string& path, std::string& content) {
     const tSize maxReadSize = 4096;
     tSize bytesToRead = (fileSize > maxReadSize) ? maxReadSize : fileSize;
     
-    std::vector<char> buffer(bytesToRead + 1, 0);
+    buffer = BufferPool::instance().acquire(bytesToRead);
+    if (!buffer.valid()) {
+        std::cerr << "Failed to allocate read buffer: " << path << std::endl;
+        hdfsCloseFile(fs_, file);
+        return false;
+    }
     
     tSize bytesRead = hdfsRead(fs_, file, buffer.data(), bytesToRead);
     hdfsCloseFile(fs_, file);
@@ -178,10 +294,10 @@ bool HdfsClient::readFile(const std::string& path, std::string& content) {
         return false;
     }
     
-    content.assign(buffer.data(), bytesRead);
+    length = bytesRead;
     
     // If file was larger than maxReadSize, log that we truncated it
-    if (fileSize > maxReadSize) {
+    if (fileSize > maxReadSize && verbose_) {
         std::cout << "Note: File size (" << fileSize << " bytes) exceeds maximum read size. Content truncated to " << maxReadSize << " bytes." << std::endl;
     }
     
@@ -189,12 +305,20 @@ bool HdfsClient::readFile(const std::string& path, std::string& content) {
 }
 
 bool HdfsClient::writeFile(const std::string& path, const std::string& content) {
+    return writeFile(path, content.data(), content.length());
+}
+
+bool HdfsClient::writeFile(const std::string& path, const char* data, size_t length) {
+    std::shared_lock<std::shared_timed_mutex> lock(stateMutex_);
+
     if (!connected_ || !fs_) {
         std::cerr << "Not connected to HDFS" << std::endl;
         return false;
     }
     
-    std::cout << "Writing to file: " << path << std::endl;
+    if (verbose_) {
+        std::cout << "Writing to file: " << path << std::endl;
+    }
     
     hdfsFile file = hdfsOpenFile(fs_, path.c_str(), O_WRONLY | O_CREAT, 0, 0, 0);
     if (!file) {
@@ -202,29 +326,33 @@ bool HdfsClient::writeFile(const std::string& path, const std::string& content)
         return false;
     }
     
-    tSize bytesWritten = hdfsWrite(fs_, file, content.c_str(), content.length());
+    tSize bytesWritten = hdfsWrite(fs_, file, data, length);
     
     hdfsFlush(fs_, file);
     hdfsCloseFile(fs_, file);
     
-    if (bytesWritten != content.length()) {
+    if (bytesWritten < 0 || static_cast<size_t>(bytesWritten) != length) {
         std::cerr << "Failed to write complete content: " << path << std::endl;
-        std::cerr << "Wrote " << bytesWritten << " of " << content.length() << " bytes" << std::endl;
+        std::cerr << "Wrote " << bytesWritten << " of " << length << " bytes" << std::endl;
         return false;
     }
     
     return true;
 }
 
-bool HdfsClient::deleteFile(const std::string& path) {
+bool HdfsClient::deleteFile(const std::string& path, bool recursive) {
+    std::shared_lock<std::shared_timed_mutex> lock(stateMutex_);
+
     if (!connected_ || !fs_) {
         std::cerr << "Not connected to HDFS" << std::endl;
         return false;
     }
     
-    std::cout << "Deleting file: " << path << std::endl;
+    if (verbose_) {
+        std::cout << "Deleting file: " << path << std::endl;
+    }
     
-    int result = hdfsDelete(fs_, path.c_str(), 0);
+    int result = hdfsDelete(fs_, path.c_str(), recursive ? 1 : 0);
     if (result != 0) {
         std::cerr << "Failed to delete file: " << path << std::endl;
         return false;
@@ -232,3 +360,312 @@ bool HdfsClient::deleteFile(const std::string& path) {
     
     return true;
 }
+
+std::vector<hdfsFS> HdfsClient::acquireConnections(size_t count) {
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    std::vector<hdfsFS> connections;
+    connections.push_back(fs_);
+
+    // Grow the pool on demand, fall back to fewer connections if opening fails
+    while (pool_.size() + 1 < count) {
+        hdfsFS fs = openConnection(false);
+        if (!fs) {
+            std::cerr << "Warning: Could only open " << pool_.size() + 1 << " of " << count << " connections" << std::endl;
+            break;
+        }
+        pool_.push_back(fs);
+    }
+
+    for (size_t i = 0; i < pool_.size() && connections.size() < count; i++) {
+        connections.push_back(pool_[i]);
+    }
+    return connections;
+}
+
+bool HdfsClient::expandComponents(const std::string& dir, bool dirListed, const std::vector<std::string>& components,
+                                  size_t index, size_t maxMatches, std::set<std::string>& matches) {
+    // Stop early once the safety limit is exceeded
+    if (maxMatches > 0 && matches.size() > maxMatches) {
+        return true;
+    }
+
+    if (index == components.size()) {
+        matches.insert(dir);
+        return true;
+    }
+
+    const std::string& component = components[index];
+    bool last = (index + 1 == components.size());
+
+    // Literal components are appended without listing the parent directory
+    if (!GlobPattern::hasWildcard(component)) {
+        std::string path = GlobPattern::join(dir, GlobPattern::unescape(component));
+        if (last) {
+            if (hdfsExists(fs_, path.c_str()) == 0) {
+                matches.insert(path);
+            }
+            return true;
+        }
+        return expandComponents(path, false, components, index + 1, maxMatches, matches);
+    }
+
+    // Listing a plain file returns the file itself, so verify unlisted parents first
+    std::string listPath = dir.empty() ? "." : dir;
+    if (!dirListed) {
+        hdfsFileInfo* dirInfo = hdfsGetPathInfo(fs_, listPath.c_str());
+        if (!dirInfo) {
+            return true;  // Parent does not exist, nothing matches
+        }
+        bool isDirectory = (dirInfo->mKind == kObjectKindDirectory);
+        hdfsFreeFileInfo(dirInfo, 1);
+        if (!isDirectory) {
+            return true;
+        }
+    }
+
+    bool recursive = GlobPattern::isRecursiveWildcard(component);
+    // '**' matches zero directories too, except as the last component where
+    // that would select the directory itself
+    if (recursive && !last) {
+        if (!expandComponents(dir, true, components, index + 1, maxMatches, matches)) {
+            return false;
+        }
+    }
+
+    errno = 0;
+    int numEntries = 0;
+    hdfsFileInfo* fileInfo = hdfsListDirectory(fs_, listPath.c_str(), &numEntries);
+    if (!fileInfo) {
+        // Empty and vanished directories are not errors
+        if (errno == 0 || errno == ENOENT) {
+            return true;
+        }
+        std::cerr << "Failed to list directory: " << listPath << std::endl;
+        return false;
+    }
+
+    bool success = true;
+    for (int i = 0; i < numEntries && success; i++) {
+        std::string child = fileInfo[i].mName;
+        bool isDirectory = (fileInfo[i].mKind == kObjectKindDirectory);
+
+        if (recursive) {
+            if (last) {
+                matches.insert(child);
+            }
+            if (isDirectory) {
+                success = expandComponents(child, true, components, index, maxMatches, matches);
+            }
+        } else if (GlobPattern::matchComponent(component, GlobPattern::baseName(child))) {
+            if (last) {
+                matches.insert(child);
+            } else if (isDirectory) {
+                success = expandComponents(child, true, components, index + 1, maxMatches, matches);
+            }
+        }
+    }
+    hdfsFreeFileInfo(fileInfo, numEntries);
+    
+    return success;
+}
+
+bool HdfsClient::expandGlob(const std::string& pattern, size_t maxMatches, std::vector<std::string>& matches) {
+    std::shared_lock<std::shared_timed_mutex> lock(stateMutex_);
+    return expandGlobLocked(pattern, maxMatches, matches);
+}
+
+bool HdfsClient::expandGlobLocked(const std::string& pattern, size_t maxMatches, std::vector<std::string>& matches) {
+    matches.clear();
+
+    if (!connected_ || !fs_) {
+        std::cerr << "Not connected to HDFS" << std::endl;
+        return false;
+    }
+
+    std::cout << "Expanding pattern: " << pattern << std::endl;
+
+    std::set<std::string> found;
+    if (!GlobPattern::hasWildcard(pattern)) {
+        // Keep literal paths as given apart from escapes, like literal components below
+        std::string path = GlobPattern::unescape(pattern);
+        if (hdfsExists(fs_, path.c_str()) == 0) {
+            found.insert(path);
+        }
+    } else {
+        GlobPattern glob(pattern);
+        std::string root = glob.root();
+        if (root.empty()) {
+            // Anchor relative patterns at the working directory so every match is absolute
+            hdfsFileInfo* fileInfo = hdfsGetPathInfo(fs_, ".");
+            if (!fileInfo) {
+                std::cerr << "Failed to resolve working directory for pattern: " << pattern << std::endl;
+                return false;
+            }
+            root = GlobPattern::pathOf(fileInfo->mName);
+            hdfsFreeFileInfo(fileInfo, 1);
+        }
+
+        std::set<std::string> expanded;
+        if (!expandComponents(root, true, glob.components(), 0, maxMatches, expanded)) {
+            return false;
+        }
+
+        // Listings return full URIs while literal components extend the root as given,
+        // so bring every match to the pattern's own form before callers compare paths
+        for (const auto& match : expanded) {
+            found.insert(glob.authority() + GlobPattern::pathOf(match));
+        }
+    }
+
+    if (maxMatches > 0 && found.size() > maxMatches) {
+        std::cerr << "Pattern matched more than " << maxMatches << " paths: " << pattern << std::endl;
+        return false;
+    }
+
+    matches.assign(found.begin(), found.end());
+    return true;
+}
+
+bool HdfsClient::deleteGlob(const std::string& pattern, const DeleteOptions& options, DeleteResult& result) {
+    std::shared_lock<std::shared_timed_mutex> lock(stateMutex_);
+    result = DeleteResult();
+
+    std::vector<std::string> matches;
+    if (!expandGlobLocked(pattern, options.maxMatches, matches)) {
+        return false;
+    }
+
+    // A recursive delete of a directory removes everything below it
+    if (options.recursive) {
+        std::set<std::string> matched(matches.begin(), matches.end());
+        std::vector<std::string> topLevel;
+        for (const auto& path : matches) {
+            bool covered = false;
+            size_t slash = path.find_last_of('/');
+            while (!covered && slash != std::string::npos && slash > 0) {
+                covered = matched.count(path.substr(0, slash)) > 0;
+                slash = path.find_last_of('/', slash - 1);
+            }
+            if (!covered) {
+                topLevel.push_back(path);
+            }
+        }
+        matches.swap(topLevel);
+    }
+
+    result.matched = matches.size();
+    std::cout << "Pattern matched " << matches.size() << " paths" << std::endl;
+
+    if (options.dryRun) {
+        for (const auto& path : matches) {
+            std::cout << "Would delete: " << path << std::endl;
+        }
+        return true;
+    }
+
+    if (matches.empty()) {
+        return true;
+    }
+
+    size_t parallelism = options.parallelism > 0 ? options.parallelism : 1;
+    std::vector<hdfsFS> connections = acquireConnections(std::min(parallelism, matches.size()));
+
+    std::atomic<size_t> next(0);
+    std::atomic<size_t> deleted(0);
+    std::atomic<size_t> failed(0);
+    // Deletes finished so far, one increment each so progress counts are unique
+    std::atomic<size_t> completed(0);
+    std::mutex outputMutex;
+    // Report progress about every 1% of matches
+    size_t progressInterval = std::max<size_t>(1, matches.size() / 100);
+
+    auto worker = [&](hdfsFS fs) {
+        size_t index;
+        while ((index = next++) < matches.size()) {
+            const std::string& path = matches[index];
+            bool ok = (hdfsDelete(fs, path.c_str(), options.recursive ? 1 : 0) == 0);
+            if (ok) {
+                deleted++;
+            } else {
+                failed++;
+            }
+            size_t done = ++completed;
+
+            if (!ok || (options.progress && (done % progressInterval == 0 || done == matches.size()))) {
+                std::lock_guard<std::mutex> lock(outputMutex);
+                if (!ok) {
+                    std::cerr << "Failed to delete: " << path << std::endl;
+                }
+                if (options.progress) {
+                    options.progress(done, matches.size());
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < connections.size(); i++) {
+        workers.emplace_back(worker, connections[i]);
+    }
+    worker(connections[0]);
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    result.deleted = deleted;
+    result.failed = failed;
+    return result.failed == 0;
+}
+
+bool HdfsClient::followFiles(const std::vector<std::string>& paths, const FollowOptions& options,
+                             const FileFollower::DataSink& sink) {
+    std::shared_lock<std::shared_timed_mutex> lock(stateMutex_);
+
+    if (!connected_ || !fs_) {
+        std::cerr << "Not connected to HDFS" << std::endl;
+        return false;
+    }
+
+    std::vector<std::unique_ptr<FileFollower>> followers;
+    for (const auto& path : paths) {
+        followers.emplace_back(new FileFollower(fs_, path, options.initialBytes,
+                                                options.minInterval, options.maxInterval));
+    }
+
+    if (!options.follow) {
+        bool success = true;
+        for (auto& follower : followers) {
+            // A single poll stops at its byte limit, keep going until the requested tail is out
+            do {
+                follower->poll(sink);
+            } while (follower->truncatedPoll());
+            success = success && !follower->missing();
+        }
+        return success;
+    }
+
+    // Longest sleep between checks of the stop flag
+    const std::chrono::milliseconds stopCheckInterval(100);
+
+    while (!(options.stop && *options.stop)) {
+        // Poll the file that is due first
+        auto next = std::min_element(followers.begin(), followers.end(),
+            [](const std::unique_ptr<FileFollower>& a, const std::unique_ptr<FileFollower>& b) {
+                return a->nextPoll() < b->nextPoll();
+            });
+        if (next == followers.end()) {
+            break;
+        }
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if ((*next)->nextPoll() > now) {
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                (*next)->nextPoll() - now, stopCheckInterval));
+            continue;
+        }
+
+        (*next)->poll(sink);
+    }
+
+    return true;
+}
@@ -1,7 +1,16 @@
 #include "hdfs_client.h"
+#include "startup_profiler.h"
+#include "glob_pattern.h"
+#include "buffer_pool.h"
 #include <iostream>
 #include <string>
 #include <cstdlib> // For using getenv function
+#include <cstring>
+#include <csignal>
+#include <atomic>
+#include <cerrno>
+#include <limits>
+#include <cstdint>
 
 #define VERSION "1.0.0"
 
@@ -12,12 +21,24 @@ void printVersion() {
 }
 
 void printUsage() {
-    std::cout << "Usage: hdfs_client <command> [arguments]" << std::endl;
+    std::cout << "Usage: hdfs_client [options] <command> [arguments]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --profile-startup      - Print timing of config load, JVM init, login and connect" << std::endl;
+    std::cout << "  --buffer-stats         - Print I/O buffer pool statistics on exit" << std::endl;
     std::cout << "Commands:" << std::endl;
     std::cout << "  list <path>            - List files in directory" << std::endl;
     std::cout << "  read <path>            - Read file content" << std::endl;
+    std::cout << "  tail [opts] <path>...  - Print the end of files" << std::endl;
+    std::cout << "    -f                   - Keep printing appended data until interrupted" << std::endl;
+    std::cout << "    --bytes=N            - Print the last N bytes first (default 1024)" << std::endl;
+    std::cout << "    --interval=MS        - Poll interval while data is arriving (default 100)" << std::endl;
+    std::cout << "    --max-interval=MS    - Longest poll interval while idle (default 5000)" << std::endl;
     std::cout << "  write <path> <content> - Write content to file" << std::endl;
-    std::cout << "  delete <path>          - Delete file" << std::endl;
+    std::cout << "  delete [opts] <path>   - Delete file, or all paths matching a glob (*, ?, [...], **)" << std::endl;
+    std::cout << "    -r                   - Delete directories recursively" << std::endl;
+    std::cout << "    --dry-run            - Only print matching paths" << std::endl;
+    std::cout << "    --max-matches=N      - Refuse if more than N paths match (default 10000, 0 = no limit)" << std::endl;
+    std::cout << "    --parallelism=N      - Number of concurrent delete connections (default 8)" << std::endl;
     std::cout << "  version                - Show version information" << std::endl;
     std::cout << "  help                   - Show this help message" << std::endl;
     std::cout << std::endl;
@@ -27,13 +48,148 @@ void printUsage() {
     std::cout << "  HADOOP_CONF_DIR        - Directory containing Hadoop configuration files" << std::endl;
 }
 
+// Set by SIGINT/SIGTERM to stop following files
+std::atomic<bool> stopRequested(false);
+
+void handleStopSignal(int) {
+    stopRequested = true;
+}
+
+// Parse a non-negative decimal number, rejecting empty, signed or trailing text
+bool parseCount(const char* text, size_t& value) {
+    if (*text < '0' || *text > '9') {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long parsed = std::strtoull(text, &end, 10);
+    if (errno == ERANGE || *end != '\0' || parsed > std::numeric_limits<size_t>::max()) {
+        return false;
+    }
+    value = static_cast<size_t>(parsed);
+    return true;
+}
+
+// Longest accepted poll interval, larger values would overflow steady_clock arithmetic
+const size_t kMaxTailIntervalMs = 24 * 60 * 60 * 1000;
+
+// Parse tail options, returns false on unknown options, invalid values or missing paths
+bool parseTailArgs(char** args, int numArgs, FollowOptions& options, std::vector<std::string>& paths) {
+    options.follow = false;
+    for (int i = 0; i < numArgs; i++) {
+        std::string arg = args[i];
+        size_t value = 0;
+        if (arg == "-f") {
+            options.follow = true;
+        } else if (arg.compare(0, 8, "--bytes=") == 0) {
+            // Byte counts become file offsets
+            if (!parseCount(arg.c_str() + 8, value) || value > static_cast<size_t>(INT64_MAX)) {
+                std::cerr << "Invalid value for --bytes: " << arg.substr(8) << std::endl;
+                return false;
+            }
+            options.initialBytes = value;
+        } else if (arg.compare(0, 11, "--interval=") == 0) {
+            if (!parseCount(arg.c_str() + 11, value) || value == 0 || value > kMaxTailIntervalMs) {
+                std::cerr << "Invalid value for --interval: " << arg.substr(11) << std::endl;
+                return false;
+            }
+            options.minInterval = std::chrono::milliseconds(value);
+        } else if (arg.compare(0, 15, "--max-interval=") == 0) {
+            if (!parseCount(arg.c_str() + 15, value) || value > kMaxTailIntervalMs) {
+                std::cerr << "Invalid value for --max-interval: " << arg.substr(15) << std::endl;
+                return false;
+            }
+            options.maxInterval = std::chrono::milliseconds(value);
+        } else if (arg[0] == '-') {
+            return false;
+        } else {
+            paths.push_back(arg);
+        }
+    }
+    return !paths.empty();
+}
+
+// Parse delete options, returns false on unknown options, invalid values or a missing path
+bool parseDeleteArgs(char** args, int numArgs, DeleteOptions& options, std::string& path) {
+    for (int i = 0; i < numArgs; i++) {
+        std::string arg = args[i];
+        if (arg == "-r") {
+            options.recursive = true;
+        } else if (arg == "--dry-run") {
+            options.dryRun = true;
+        } else if (arg.compare(0, 14, "--max-matches=") == 0) {
+            // Only an explicit 0 disables the limit
+            if (!parseCount(arg.c_str() + 14, options.maxMatches)) {
+                std::cerr << "Invalid value for --max-matches: " << arg.substr(14) << std::endl;
+                return false;
+            }
+        } else if (arg.compare(0, 14, "--parallelism=") == 0) {
+            size_t parallelism = 0;
+            if (!parseCount(arg.c_str() + 14, parallelism) || parallelism == 0 ||
+                parallelism > static_cast<size_t>(std::numeric_limits<int>::max())) {
+                std::cerr << "Invalid value for --parallelism: " << arg.substr(14) << std::endl;
+                return false;
+            }
+            options.parallelism = static_cast<int>(parallelism);
+        } else if (arg[0] == '-' || !path.empty()) {
+            return false;
+        } else {
+            path = arg;
+        }
+    }
+    return !path.empty();
+}
+
+bool isValidCommand(const std::string& command, char** args, int numArgs) {
+    if (command == "list" || command == "read") {
+        return numArgs >= 1;
+    }
+    if (command == "delete") {
+        DeleteOptions options;
+        std::string path;
+        return parseDeleteArgs(args, numArgs, options, path);
+    }
+    if (command == "write") {
+        return numArgs >= 2;
+    }
+    if (command == "tail") {
+        FollowOptions options;
+        std::vector<std::string> paths;
+        return parseTailArgs(args, numArgs, options, paths);
+    }
+    return false;
+}
+
 int main(int argc, char* argv[]) {
-    if (argc < 2) {
+    StartupProfiler profiler;
+    bool profileStartup = false;
+    bool bufferStats = false;
+
+    // Parse leading options
+    int argIndex = 1;
+    while (argIndex < argc && std::string(argv[argIndex]).compare(0, 2, "--") == 0) {
+        std::string option = argv[argIndex];
+        if (option == "--profile-startup") {
+            profileStartup = true;
+        } else if (option == "--buffer-stats") {
+            bufferStats = true;
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            printUsage();
+            return 1;
+        }
+        argIndex++;
+    }
+
+    if (argIndex >= argc) {
         printUsage();
         return 1;
     }
 
-    std::string command = argv[1];
+    std::string command = argv[argIndex];
+    // Command arguments start at argv[argIndex + 1]
+    char** args = argv + argIndex + 1;
+    int numArgs = argc - argIndex - 1;
     
     // Handle special commands that don't require HDFS connection
     if (command == "version") {
@@ -44,22 +200,44 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    // Validate arguments before paying for JVM startup
+    if (!isValidCommand(command, args, numArgs)) {
+        printUsage();
+        return 1;
+    }
+
+    // tail writes file data to stdout, so diagnostics go to stderr and client messages are off
+    bool dataOnStdout = (command == "tail");
+    std::ostream& info = dataOnStdout ? std::cerr : std::cout;
+
+    HdfsClient client;
+    client.setStartupProfiler(&profiler);
+    client.setVerbose(!dataOnStdout);
+    // Boot the JVM in the background as early as possible
+    client.warmUp();
+
     // Show environment information for debugging
     const char* defaultFs = std::getenv("HDFS_DEFAULT_FS");
     if (defaultFs != nullptr) {
-        std::cout << "Using HDFS_DEFAULT_FS: " << defaultFs << std::endl;
+        info << "Using HDFS_DEFAULT_FS: " << defaultFs << std::endl;
     }
     
-    HdfsClient client;
-    
     // Connect to HDFS
     if (!client.connect()) {
         std::cerr << "Failed to connect to HDFS" << std::endl;
+        if (profileStartup) {
+            profiler.printReport(info);
+        }
         return 1;
     }
 
-    if (command == "list" && argc >= 3) {
-        std::string path = argv[2];
+    if (profileStartup) {
+        profiler.printReport(info);
+    }
+
+    int exitCode = 0;
+    if (command == "list") {
+        std::string path = args[0];
         std::vector<std::string> files = client.listDirectory(path);
         
         std::cout << "Files in " << path << ":" << std::endl;
@@ -67,42 +245,92 @@ int main(int argc, char* argv[]) {
             std::cout << "  " << file << std::endl;
         }
     }
-    else if (command == "read" && argc >= 3) {
-        std::string path = argv[2];
-        std::string content;
+    else if (command == "read") {
+        std::string path = args[0];
+        BufferPool::Buffer content;
+        size_t length = 0;
         
-        if (client.readFile(path, content)) {
-            std::cout << "Successfully read " << content.size() << " bytes from " << path << std::endl;
+        if (client.readFile(path, content, length)) {
+            std::cout << "Successfully read " << length << " bytes from " << path << std::endl;
         } else {
             std::cerr << "Failed to read file: " << path << std::endl;
         }
     }
-    else if (command == "write" && argc >= 4) {
-        std::string path = argv[2];
-        std::string content = argv[3];
+    else if (command == "tail") {
+        FollowOptions options;
+        std::vector<std::string> paths;
+        parseTailArgs(args, numArgs, options, paths);
+
+        options.stop = &stopRequested;
+        std::signal(SIGINT, handleStopSignal);
+        std::signal(SIGTERM, handleStopSignal);
+
+        // Print a header like tail(1) whenever output switches between files
+        std::string lastPath;
+        bool success = client.followFiles(paths, options,
+            [&](const std::string& path, const char* data, size_t length) {
+                if (paths.size() > 1 && path != lastPath) {
+                    std::cout << std::endl << "==> " << path << " <==" << std::endl;
+                    lastPath = path;
+                }
+                std::cout.write(data, length);
+                std::cout.flush();
+            });
+        if (!success) {
+            std::cerr << "Failed to tail files" << std::endl;
+            exitCode = 1;
+        }
+    }
+    else if (command == "write") {
+        std::string path = args[0];
+        // Write straight from argv instead of copying into a string
+        const char* content = args[1];
+        size_t length = std::strlen(content);
         
-        if (client.writeFile(path, content)) {
-            std::cout << "Successfully wrote " << content.size() << " bytes to file: " << path << std::endl;
+        if (client.writeFile(path, content, length)) {
+            std::cout << "Successfully wrote " << length << " bytes to file: " << path << std::endl;
         } else {
             std::cerr << "Failed to write to file: " << path << std::endl;
         }
     }
-    else if (command == "delete" && argc >= 3) {
-        std::string path = argv[2];
-        
-        if (client.deleteFile(path)) {
-            std::cout << "Successfully deleted file: " << path << std::endl;
+    else if (command == "delete") {
+        DeleteOptions options;
+        std::string path;
+        parseDeleteArgs(args, numArgs, options, path);
+
+        if (!GlobPattern::hasWildcard(path) && !options.dryRun) {
+            path = GlobPattern::unescape(path);
+            if (client.deleteFile(path, options.recursive)) {
+                std::cout << "Successfully deleted file: " << path << std::endl;
+            } else {
+                std::cerr << "Failed to delete file: " << path << std::endl;
+                exitCode = 1;
+            }
         } else {
-            std::cerr << "Failed to delete file: " << path << std::endl;
+            options.progress = [](size_t completed, size_t total) {
+                std::cout << "Deleted " << completed << "/" << total << " paths" << std::endl;
+            };
+
+            DeleteResult result;
+            if (!client.deleteGlob(path, options, result)) {
+                std::cerr << "Failed to delete paths matching: " << path << " (" << result.deleted << " deleted, "
+                          << result.failed << " failed)" << std::endl;
+                exitCode = 1;
+            } else if (options.dryRun) {
+                std::cout << "Dry run: " << result.matched << " paths match: " << path << std::endl;
+            } else {
+                std::cout << "Successfully deleted " << result.deleted << " of " << result.matched
+                          << " paths matching: " << path << std::endl;
+            }
         }
     }
-    else {
-        printUsage();
-        return 1;
-    }
 
     // Disconnect from HDFS
     client.disconnect();
+
+    if (bufferStats) {
+        BufferPool::instance().printStats(info);
+    }
     
-    return 0;
-} 
\ No newline at end of file
+    return exitCode;
+}
@@ -0,0 +1,85 @@
+#include "startup_profiler.h"
+#include <iomanip>
+
+StartupProfiler::Scope::Scope(StartupProfiler* profiler, const std::string& phase)
+    : profiler_(profiler), phase_(phase) {
+    if (profiler_) {
+        profiler_->begin(phase_);
+    }
+}
+
+StartupProfiler::Scope::~Scope() {
+    if (profiler_) {
+        profiler_->end(phase_);
+    }
+}
+
+StartupProfiler::StartupProfiler() : origin_(Clock::now()) {
+}
+
+void StartupProfiler::begin(const std::string& phase) {
+    Phase entry;
+    entry.name = phase;
+    entry.start = Clock::now();
+    entry.end = entry.start;
+    entry.finished = false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    phases_.push_back(entry);
+}
+
+void StartupProfiler::end(const std::string& phase) {
+    Clock::time_point now = Clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Close the most recent unfinished phase with this name
+    for (auto it = phases_.rbegin(); it != phases_.rend(); ++it) {
+        if (it->name == phase && !it->finished) {
+            it->end = now;
+            it->finished = true;
+            return;
+        }
+    }
+}
+
+void StartupProfiler::printReport(std::ostream& out) const {
+    typedef std::chrono::duration<double, std::milli> Millis;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    Clock::time_point last = origin_;
+    double serialMs = 0;
+
+    out << "Startup profile:" << std::endl;
+    out << "  " << std::left << std::setw(24) << "phase"
+        << std::right << std::setw(12) << "start(ms)"
+        << std::setw(12) << "end(ms)"
+        << std::setw(14) << "duration(ms)" << std::endl;
+
+    out << std::fixed << std::setprecision(2);
+    for (const auto& phase : phases_) {
+        Clock::time_point end = phase.finished ? phase.end : Clock::now();
+        double startMs = Millis(phase.start - origin_).count();
+        double endMs = Millis(end - origin_).count();
+        double durationMs = endMs - startMs;
+
+        out << "  " << std::left << std::setw(24) << phase.name
+            << std::right << std::setw(12) << startMs
+            << std::setw(12) << endMs
+            << std::setw(14) << durationMs
+            << (phase.finished ? "" : " (unfinished)") << std::endl;
+
+        serialMs += durationMs;
+        if (end > last) {
+            last = end;
+        }
+    }
+
+    double wallMs = Millis(last - origin_).count();
+    out << "  Total wall time: " << wallMs << " ms" << std::endl;
+    // Sum of phase durations exceeding wall time means phases overlapped
+    out << "  Sum of phases:   " << serialMs << " ms" << std::endl;
+    out.flags(flags);
+    out.precision(precision);
+}
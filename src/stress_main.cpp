@@ -0,0 +1,83 @@
+#include "hdfs_client.h"
+#include "buffer_pool.h"
+#include "stress_runner.h"
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+void printUsage() {
+    std::cout << "Usage: hdfs_stress [options] <dir>" << std::endl;
+    std::cout << "Runs concurrent write/read/list/delete operations under dir and verifies every result" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --threads=N            - Number of threads (default 8)" << std::endl;
+    std::cout << "  --ops=N                - Operations per thread (default 1000)" << std::endl;
+    std::cout << "  --file-size=N          - Bytes per file, 1 to 4096 (default 1024)" << std::endl;
+    std::cout << "  --scale                - Also run with 1, 2, 4, ... threads and report scaling" << std::endl;
+    std::cout << "  --buffer-stats         - Print I/O buffer pool statistics on exit" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Environment Variables:" << std::endl;
+    std::cout << "  HDFS_DEFAULT_FS        - Default FileSystem URI (e.g. hdfs://namenode:8020)" << std::endl;
+    std::cout << "  CLASSPATH              - Java classpath for HDFS libraries" << std::endl;
+    std::cout << "  HADOOP_CONF_DIR        - Directory containing Hadoop configuration files" << std::endl;
+}
+
+// Parse stress options, returns false on invalid options or a missing directory
+bool parseStressArgs(char** args, int numArgs, StressOptions& options, bool& bufferStats) {
+    for (int i = 0; i < numArgs; i++) {
+        std::string arg = args[i];
+        if (arg.compare(0, 10, "--threads=") == 0) {
+            options.threads = std::atoi(arg.c_str() + 10);
+        } else if (arg.compare(0, 6, "--ops=") == 0) {
+            options.opsPerThread = std::atoi(arg.c_str() + 6);
+        } else if (arg.compare(0, 12, "--file-size=") == 0) {
+            options.fileSize = std::strtoul(arg.c_str() + 12, nullptr, 10);
+        } else if (arg == "--scale") {
+            options.scale = true;
+        } else if (arg == "--buffer-stats") {
+            bufferStats = true;
+        } else if (arg[0] == '-' || !options.baseDir.empty()) {
+            return false;
+        } else {
+            options.baseDir = arg;
+        }
+    }
+    return !options.baseDir.empty() && options.threads > 0 && options.opsPerThread > 0 &&
+           options.fileSize > 0 && options.fileSize <= 4096;
+}
+
+int main(int argc, char* argv[]) {
+    StressOptions options;
+    bool bufferStats = false;
+
+    // Validate arguments before paying for JVM startup
+    if (!parseStressArgs(argv + 1, argc - 1, options, bufferStats)) {
+        printUsage();
+        return 1;
+    }
+
+    HdfsClient client;
+    client.warmUp();
+
+    const char* defaultFs = std::getenv("HDFS_DEFAULT_FS");
+    if (defaultFs != nullptr) {
+        std::cout << "Using HDFS_DEFAULT_FS: " << defaultFs << std::endl;
+    }
+
+    if (!client.connect()) {
+        std::cerr << "Failed to connect to HDFS" << std::endl;
+        return 1;
+    }
+
+    // Per-operation messages would serialize threads on stdout
+    client.setVerbose(false);
+    StressRunner runner(client, options);
+    int exitCode = runner.run() ? 0 : 1;
+
+    client.disconnect();
+
+    if (bufferStats) {
+        BufferPool::instance().printStats(std::cout);
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,221 @@
+#include "stress_runner.h"
+#include "buffer_pool.h"
+#include "glob_pattern.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+
+namespace {
+
+// Maximum number of failures printed per run
+const size_t kMaxReportedFailures = 20;
+// Width of the throughput bar chart
+const int kBarWidth = 40;
+
+// Fill buffer with content unique to this thread and file
+void fillContent(char* buffer, size_t size, int threadId, int fileIndex) {
+    std::ostringstream header;
+    header << "thread-" << threadId << "-file-" << fileIndex << ":";
+    std::string prefix = header.str();
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (i < prefix.size()) ? prefix[i] : static_cast<char>('a' + (i + threadId + fileIndex) % 26);
+    }
+}
+
+}  // namespace
+
+StressRunner::StressRunner(HdfsClient& client, const StressOptions& options)
+    : client_(client), options_(options), reportedFailures_(0) {
+}
+
+bool StressRunner::run() {
+    std::vector<int> threadCounts;
+    if (options_.scale) {
+        for (int threads = 1; threads < options_.threads; threads *= 2) {
+            threadCounts.push_back(threads);
+        }
+    }
+    threadCounts.push_back(options_.threads);
+
+    std::vector<StressRoundResult> results;
+    size_t failures = 0;
+    for (size_t round = 0; round < threadCounts.size(); round++) {
+        std::cout << "Running " << threadCounts[round] << " threads x " << options_.opsPerThread
+                  << " operations" << std::endl;
+        StressRoundResult result = runRound(threadCounts[round], round);
+        failures += result.failures;
+        results.push_back(result);
+    }
+
+    printReport(results);
+
+    if (failures > 0) {
+        std::cerr << "Stress test failed: " << failures << " operations failed verification" << std::endl;
+        return false;
+    }
+    std::cout << "All operations verified" << std::endl;
+    return true;
+}
+
+StressRoundResult StressRunner::runRound(int threads, int round) {
+    std::string roundDir = GlobPattern::join(options_.baseDir, "round-" + std::to_string(round));
+    std::vector<size_t> failures(threads, 0);
+
+    // Start all threads together so thread creation is not part of the timing
+    std::mutex startMutex;
+    std::condition_variable startSignal;
+    int ready = 0;
+    bool started = false;
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; i++) {
+        workers.emplace_back([&, i]() {
+            std::string dir = GlobPattern::join(roundDir, "thread-" + std::to_string(i));
+            {
+                std::unique_lock<std::mutex> lock(startMutex);
+                ready++;
+                startSignal.notify_all();
+                startSignal.wait(lock, [&]() { return started; });
+            }
+            runThread(dir, i, failures[i]);
+        });
+    }
+
+    std::chrono::steady_clock::time_point start;
+    {
+        std::unique_lock<std::mutex> lock(startMutex);
+        startSignal.wait(lock, [&]() { return ready == threads; });
+        started = true;
+        start = std::chrono::steady_clock::now();
+        startSignal.notify_all();
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    StressRoundResult result;
+    result.threads = threads;
+    result.operations = static_cast<size_t>(threads) * options_.opsPerThread;
+    result.seconds = elapsed.count();
+    for (size_t count : failures) {
+        result.failures += count;
+    }
+
+    client_.deleteFile(roundDir, true);
+    return result;
+}
+
+void StressRunner::runThread(const std::string& dir, int threadId, size_t& failures) {
+    BufferPool::Buffer expected = BufferPool::instance().acquire(options_.fileSize);
+    if (!expected.valid()) {
+        reportFailure("Failed to allocate write buffer");
+        failures += options_.opsPerThread;
+        return;
+    }
+
+    std::string path;
+    BufferPool::Buffer content;
+    size_t length = 0;
+    for (int i = 0; i < options_.opsPerThread; i++) {
+        // Each file goes through write, read, list and delete
+        int fileIndex = i / 4;
+        std::string name = "file-" + std::to_string(fileIndex);
+        path = GlobPattern::join(dir, name);
+
+        switch (i % 4) {
+        case 0:
+            fillContent(expected.data(), options_.fileSize, threadId, fileIndex);
+            if (!client_.writeFile(path, expected.data(), options_.fileSize)) {
+                reportFailure("write failed: " + path);
+                failures++;
+            }
+            break;
+        case 1:
+            if (!client_.readFile(path, content, length)) {
+                reportFailure("read failed: " + path);
+                failures++;
+            } else if (length != options_.fileSize ||
+                       std::memcmp(content.data(), expected.data(), options_.fileSize) != 0) {
+                reportFailure("read returned wrong content: " + path);
+                failures++;
+            }
+            break;
+        case 2: {
+            // Earlier files were deleted, so the directory holds exactly this file
+            std::vector<std::string> entries = client_.listDirectory(dir);
+            if (entries.size() != 1 || GlobPattern::baseName(entries[0]) != name) {
+                reportFailure("list of " + dir + " returned " + std::to_string(entries.size()) +
+                              " entries, expected only " + name);
+                failures++;
+            }
+            break;
+        }
+        default:
+            if (!client_.deleteFile(path)) {
+                reportFailure("delete failed: " + path);
+                failures++;
+            }
+            break;
+        }
+    }
+}
+
+void StressRunner::reportFailure(const std::string& message) {
+    std::lock_guard<std::mutex> lock(outputMutex_);
+    if (reportedFailures_ < kMaxReportedFailures) {
+        std::cerr << "Verification failure: " << message << std::endl;
+    } else if (reportedFailures_ == kMaxReportedFailures) {
+        std::cerr << "Further verification failures suppressed" << std::endl;
+    }
+    reportedFailures_++;
+}
+
+void StressRunner::printReport(const std::vector<StressRoundResult>& results) const {
+    double baseline = 0;
+    double best = 0;
+    for (const auto& result : results) {
+        double rate = result.seconds > 0 ? result.operations / result.seconds : 0;
+        if (result.threads == 1) {
+            baseline = rate;
+        }
+        if (rate > best) {
+            best = rate;
+        }
+    }
+
+    std::ios_base::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+
+    std::cout << "Stress results:" << std::endl;
+    std::cout << "  " << std::setw(8) << "threads" << std::setw(10) << "ops" << std::setw(10) << "failures"
+              << std::setw(10) << "seconds" << std::setw(12) << "ops/s" << std::setw(9) << "speedup"
+              << std::setw(12) << "efficiency" << "  throughput" << std::endl;
+
+    std::cout << std::fixed;
+    for (const auto& result : results) {
+        double rate = result.seconds > 0 ? result.operations / result.seconds : 0;
+        int bar = best > 0 ? static_cast<int>(rate / best * kBarWidth + 0.5) : 0;
+
+        std::cout << "  " << std::setw(8) << result.threads << std::setw(10) << result.operations
+                  << std::setw(10) << result.failures << std::setprecision(3) << std::setw(10) << result.seconds
+                  << std::setprecision(1) << std::setw(12) << rate;
+        // Speedup and efficiency are relative to the single-thread round
+        if (baseline > 0) {
+            double speedup = rate / baseline;
+            std::cout << std::setprecision(2) << std::setw(8) << speedup << "x"
+                      << std::setprecision(0) << std::setw(11) << speedup / result.threads * 100 << "%";
+        } else {
+            std::cout << std::setw(9) << "-" << std::setw(12) << "-";
+        }
+        std::cout << "  " << std::string(bar, '#') << std::endl;
+    }
+
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+}